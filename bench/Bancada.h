@@ -0,0 +1,157 @@
+/**
+ * @file Bancada.h
+ * @brief Bancada de medição mínima para os benchmarks do projeto.
+ * @details Executa cada caso algumas vezes, guarda o melhor tempo e a mediana por
+ * operação e exporta os resultados em JSON, para acompanhar regressões sem
+ * depender de bibliotecas externas.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @class Bancada
+ * @brief Registra e executa casos de benchmark.
+ */
+class Bancada {
+public:
+    /**
+     * @struct Medida
+     * @brief Resultado de um caso: tempos por operação em nanossegundos.
+     */
+    struct Medida {
+        std::string nome;
+        long long operacoes; // operações por repetição
+        int repeticoes;
+        double melhorNs;     // melhor repetição, por operação
+        double medianaNs;    // mediana das repetições, por operação
+        std::vector<std::pair<std::string, double>> anotacoes; // métricas extras do caso
+    };
+
+    /**
+     * @brief Cria a bancada.
+     * @param filtro Só casos cujo nome contém `filtro` são executados (vazio: todos).
+     */
+    explicit Bancada(std::string filtro = "") : filtro(std::move(filtro)) {}
+
+    /**
+     * @brief Mede um caso.
+     * @param nome O nome do caso (ex.: "novelo/empilhar_desempilhar/1000000").
+     * @param operacoes Quantas operações uma chamada de `corpo` realiza.
+     * @param repeticoes Quantas vezes `corpo` é executado.
+     * @param corpo O código medido.
+     */
+    template <typename Corpo>
+    void medir(const std::string& nome, long long operacoes, int repeticoes, Corpo&& corpo) {
+        if (!selecionado(nome)) return;
+        std::vector<double> tempos;
+        tempos.reserve(repeticoes);
+        for (int r = 0; r < repeticoes; ++r) {
+            auto inicio = std::chrono::steady_clock::now();
+            corpo();
+            auto fim = std::chrono::steady_clock::now();
+            tempos.push_back(std::chrono::duration<double, std::nano>(fim - inicio).count());
+        }
+        std::sort(tempos.begin(), tempos.end());
+        const double ops = static_cast<double>(std::max(1LL, operacoes));
+        Medida m{nome, operacoes, repeticoes, tempos.front() / ops, tempos[tempos.size() / 2] / ops, {}};
+        medidas.push_back(m);
+        std::cout << std::left << std::setw(48) << nome << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(14) << m.melhorNs << " ns/op" << std::setw(14) << m.medianaNs << " ns/op (mediana)\n";
+    }
+
+    /**
+     * @brief Obtém a medida de um caso já executado.
+     * @return A medida, ou `nullptr` se o caso não foi medido (por exemplo, filtrado).
+     */
+    const Medida* medida(const std::string& nome) const {
+        for (const Medida& m : medidas) {
+            if (m.nome == nome) return &m;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Acrescenta uma métrica extra a um caso medido (ex.: taxa de sobrevivência).
+     * @details Sem efeito se o caso não foi medido (por exemplo, filtrado). Se não for o
+     * último caso medido, a linha impressa traz o nome do caso.
+     * @param nome O caso ao qual a métrica pertence.
+     * @param chave O nome do campo no JSON.
+     * @param valor O valor da métrica.
+     */
+    void anotar(const std::string& nome, const std::string& chave, double valor) {
+        for (auto m = medidas.rbegin(); m != medidas.rend(); ++m) {
+            if (m->nome != nome) continue;
+            m->anotacoes.emplace_back(chave, valor);
+            std::cout << "    " << (m == medidas.rbegin() ? "" : nome + ": ") << chave << " = " << std::fixed
+                      << std::setprecision(3) << valor << '\n';
+            return;
+        }
+    }
+
+    /**
+     * @brief Indica se um caso (ou grupo de casos) passa pelo filtro.
+     * @details Útil para pular a preparação cara de casos que não serão medidos.
+     */
+    bool selecionado(const std::string& nome) const {
+        return filtro.empty() || nome.find(filtro) != std::string::npos || filtro.find(nome) != std::string::npos;
+    }
+
+    /**
+     * @brief Indica se o filtro pede explicitamente um trecho (ex.: um tamanho).
+     * @details Para casos caros demais para a execução padrão, que só rodam quando o
+     * filtro contém `trecho` (ex.: `--filtro 10000000`).
+     */
+    bool explicito(const std::string& trecho) const {
+        return filtro.find(trecho) != std::string::npos;
+    }
+
+    /**
+     * @brief Registra uma verificação que falhou (ex.: resultados divergentes entre casos).
+     * @details A mensagem vai para `std::cerr` e `labirinto_bench` termina com código 1,
+     * depois de gravar as medidas.
+     */
+    void falhar(const std::string& motivo) {
+        std::cerr << motivo << std::endl;
+        falhas++;
+    }
+
+    /// @brief Número de verificações que falharam.
+    int getFalhas() const { return falhas; }
+
+    /**
+     * @brief Impede que o compilador descarte um valor calculado apenas para medição.
+     */
+    template <typename T>
+    static void naoOtimizar(const T& valor) {
+        asm volatile("" : : "g"(&valor) : "memory");
+    }
+
+    /**
+     * @brief Escreve as medidas em JSON.
+     */
+    void salvarJson(std::ostream& saida) const {
+        saida << "{\n  \"benchmarks\": [";
+        for (size_t i = 0; i < medidas.size(); ++i) {
+            const Medida& m = medidas[i];
+            saida << (i ? ",\n" : "\n") << "    { \"nome\": \"" << m.nome << "\", \"operacoes\": " << m.operacoes
+                  << ", \"repeticoes\": " << m.repeticoes << std::fixed << std::setprecision(3)
+                  << ", \"melhorNsPorOp\": " << m.melhorNs << ", \"medianaNsPorOp\": " << m.medianaNs;
+            for (const auto& [chave, valor] : m.anotacoes) saida << ", \"" << chave << "\": " << valor;
+            saida << " }";
+        }
+        saida << "\n  ]\n}\n";
+    }
+
+private:
+    std::string filtro;
+    std::vector<Medida> medidas;
+    int falhas = 0;
+};
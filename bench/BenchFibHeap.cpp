@@ -0,0 +1,54 @@
+/**
+ * @file BenchFibHeap.cpp
+ * @brief Vazão de `extrairMin` do heap de Fibonacci.
+ * @details O heap recebe ELEMENTOS chaves pseudoaleatórias e é esvaziado por
+ * `extrairMin`; o tempo é por extração (as inserções, O(1), entram no total). O
+ * segundo caso intercala inserções e extrações com o heap em torno de 10^6 nós,
+ * como numa fila de Dijkstra.
+ */
+
+#include "Benchmarks.h"
+#include "estruturas/FibHeap.h"
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int ELEMENTOS = 10000000;
+constexpr int JANELA = 1000000;
+
+std::vector<int> chavesAleatorias(int n) {
+    std::mt19937 gerador(2024);
+    std::vector<int> chaves(n);
+    for (int& c : chaves) c = static_cast<int>(gerador() >> 1);
+    return chaves;
+}
+
+} // namespace
+
+void benchFibHeap(Bancada& bancada) {
+    const std::string n = std::to_string(ELEMENTOS);
+    if (!bancada.selecionado("fibheap/")) return;
+    const std::vector<int> chaves = chavesAleatorias(ELEMENTOS);
+
+    bancada.medir("fibheap/inserir_extrair/" + n, ELEMENTOS, 2, [&] {
+        FibHeap<int> heap;
+        for (int c : chaves) heap.inserir(c);
+        long long soma = 0;
+        while (!heap.ehVazio()) soma += heap.extrairMin();
+        Bancada::naoOtimizar(soma);
+    });
+
+    bancada.medir("fibheap/janela/" + n, ELEMENTOS, 2, [&] {
+        FibHeap<int> heap;
+        for (int i = 0; i < JANELA; ++i) heap.inserir(chaves[i]);
+        long long soma = 0;
+        for (int i = JANELA; i < ELEMENTOS; ++i) {
+            int minimo = heap.extrairMin();
+            soma += minimo;
+            heap.inserir(minimo + (chaves[i] & 0xFFFF)); // chaves monótonas, como distâncias
+        }
+        Bancada::naoOtimizar(soma);
+    });
+}
@@ -0,0 +1,84 @@
+/**
+ * @file BenchFilas.cpp
+ * @brief Dijkstra de `Grafo::distanciasDe` com cada fila de prioridade.
+ * @details Labirintos em grade com 10^4, 10^5 e 10^6 salas (10^7 só com o filtro
+ * explícito, ex.: `--filtro 10000000`) resolvidos a partir da sala 0 com FibHeap,
+ * HeapQuaternario, HeapPareamento e HeapRadix. O tempo é por sala; as distâncias de
+ * todas as filas são conferidas entre si (uma divergência faz a bancada falhar) e
+ * cada caso é anotado com a sua classificação (1 = mais rápida) entre as filas do
+ * mesmo tamanho.
+ */
+
+#include "Benchmarks.h"
+#include "GeradorLabirintos.h"
+#include "estruturas/FibHeap.h"
+#include "estruturas/HeapPareamento.h"
+#include "estruturas/HeapQuaternario.h"
+#include "estruturas/HeapRadix.h"
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using Item = std::pair<int, int>;
+
+struct Caso {
+    std::string nome;
+    std::vector<int> dist;
+};
+
+template <typename Fila>
+void medirFila(Bancada& bancada, const Grafo& grafo, const std::string& nome, std::vector<Caso>& casos) {
+    if (!bancada.selecionado(nome)) return;
+    std::vector<int> dist;
+    bancada.medir(nome, grafo.getNumVertices(), 3, [&] {
+        dist = grafo.distanciasDe<Fila>(0);
+        Bancada::naoOtimizar(dist);
+    });
+    casos.push_back(Caso{nome, std::move(dist)});
+}
+
+void medirTamanho(Bancada& bancada, int salas) {
+    const std::string n = std::to_string(salas);
+    if (salas >= 10000000 && !bancada.explicito(n)) return; // 10^7: só quando pedido
+    const char* filas[] = {"fibheap", "quaternario", "pareamento", "radix"};
+    bool algum = false;
+    for (const char* fila : filas) {
+        const std::string nome = std::string("filas/") + fila + "/" + n;
+        algum = algum || bancada.selecionado(nome);
+    }
+    if (!algum) return;
+
+    Grafo grafo;
+    gerarGrade(grafo, static_cast<int>(std::lround(std::sqrt(salas))), 2024);
+
+    std::vector<Caso> casos;
+    medirFila<FibHeap<Item>>(bancada, grafo, "filas/fibheap/" + n, casos);
+    medirFila<HeapQuaternario<Item>>(bancada, grafo, "filas/quaternario/" + n, casos);
+    medirFila<HeapPareamento<Item>>(bancada, grafo, "filas/pareamento/" + n, casos);
+    medirFila<HeapRadix<Item>>(bancada, grafo, "filas/radix/" + n, casos);
+
+    for (const Caso& caso : casos) {
+        if (caso.dist != casos.front().dist) {
+            bancada.falhar("Distâncias divergentes: " + caso.nome + " x " + casos.front().nome);
+        }
+    }
+    // A classificação só é anotada depois que todas as filas do tamanho foram medidas
+    for (const Caso& caso : casos) {
+        const double tempo = bancada.medida(caso.nome)->melhorNs;
+        int posicao = 1;
+        for (const Caso& outro : casos) {
+            if (bancada.medida(outro.nome)->melhorNs < tempo) posicao++;
+        }
+        bancada.anotar(caso.nome, "classificacao", posicao);
+    }
+}
+
+} // namespace
+
+void benchFilas(Bancada& bancada) {
+    if (!bancada.selecionado("filas/")) return;
+    for (int salas : {10000, 100000, 1000000, 10000000}) medirTamanho(bancada, salas);
+}
@@ -0,0 +1,57 @@
+/**
+ * @file BenchGrafo.cpp
+ * @brief Mudanças de corredor na forma compacta do grafo.
+ * @details Em labirintos gerados de 10^3 e 10^5 salas, cada operação abre um corredor
+ * entre duas salas sorteadas e o derruba em seguida (`Grafo::definirPeso`), o que muda
+ * o grau das duas salas e reescreve os seus trechos do CSR e do alias. O caso maior é
+ * anotado com a razão do seu tempo sobre o do menor: perto de 1 quando o custo de uma
+ * mudança não depende do tamanho do labirinto.
+ */
+
+#include "Benchmarks.h"
+#include "GeradorLabirintos.h"
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr int MUDANCAS = 10000;
+
+void medirMudancas(Bancada& bancada, int salas) {
+    const std::string nome = "grafo/definirPeso/" + std::to_string(salas);
+    if (!bancada.selecionado(nome)) return;
+    Grafo grafo;
+    gerarGrafo(grafo, salas, salas, 2024);
+
+    // Pares sem corredor entre si, para que abrir e derrubar mudem o grau
+    std::mt19937 gerador(7);
+    std::uniform_int_distribution<int> sala(0, salas - 1);
+    std::vector<std::pair<int, int>> pares;
+    while (static_cast<int>(pares.size()) < MUDANCAS) {
+        const int u = sala(gerador);
+        const int v = sala(gerador);
+        if (u != v && grafo.getPesoAresta(u, v) < 0) pares.emplace_back(u, v);
+    }
+    bancada.medir(nome, 2LL * MUDANCAS, 5, [&] {
+        for (const auto& [u, v] : pares) {
+            grafo.definirPeso(u, v, 5);
+            grafo.definirPeso(u, v, 0);
+        }
+        Bancada::naoOtimizar(grafo);
+    });
+}
+
+} // namespace
+
+void benchGrafo(Bancada& bancada) {
+    if (!bancada.selecionado("grafo/")) return;
+    medirMudancas(bancada, 1000);
+    medirMudancas(bancada, 100000);
+    const Bancada::Medida* pequeno = bancada.medida("grafo/definirPeso/1000");
+    const Bancada::Medida* grande = bancada.medida("grafo/definirPeso/100000");
+    if (pequeno && grande) {
+        bancada.anotar(grande->nome, "razaoSobre1000", grande->melhorNs / pequeno->melhorNs);
+    }
+}
@@ -0,0 +1,104 @@
+/**
+ * @file BenchNovelo.cpp
+ * @brief Benchmarks do Novelo e da DFS do prisioneiro em labirintos profundos.
+ * @details Os labirintos têm cerca de 10^6 salas: um corredor único (a pilha chega
+ * a 10^6 rastros e depois é esvaziada) e um pente (espinha com um dente por sala,
+ * alternando empilhar e desempilhar a cada passo). A estrela mede o custo de
+ * voltar repetidamente a uma sala de grau alto, com a DFS (cursor) e com a aresta
+ * mais barata (varredura completa a cada volta).
+ */
+
+#include "Benchmarks.h"
+#include "estruturas/MeuPair.h"
+#include "estruturas/Novelo.h"
+#include "labirinto/Grafo.h"
+#include "labirinto/Prisioneiro.h"
+#include <string>
+
+namespace {
+
+constexpr int SALAS = 1000000;
+constexpr int GRAU_ESTRELA = 20000;
+
+// Anda até o prisioneiro não conseguir mais se mover; retorna o número de movimentos
+long long explorar(const Grafo& labirinto, int salas, PoliticaExploracao politica = PoliticaExploracao::DFS) {
+    Prisioneiro p(0, 4 * salas, salas, politica);
+    long long movimentos = 0;
+    while (p.mover(labirinto.vizinhanca(p.getPos())) > 0) {
+        movimentos++;
+    }
+    return movimentos;
+}
+
+} // namespace
+
+void benchNovelo(Bancada& bancada) {
+    const std::string n = std::to_string(SALAS);
+
+    bancada.medir("novelo/empilhar_desempilhar/" + n, 2LL * SALAS, 10, [] {
+        Novelo<MeuPair<int, int>> novelo;
+        for (int i = 0; i < SALAS; ++i) novelo.criarRastro({i, 1});
+        while (!novelo.nenhumRastro()) novelo.puxarRastro();
+        Bancada::naoOtimizar(novelo);
+    });
+
+    bancada.medir("novelo/alternado/" + n, 2LL * SALAS, 10, [] {
+        Novelo<MeuPair<int, int>> novelo;
+        novelo.criarRastro({0, 0});
+        for (int i = 0; i < SALAS; ++i) {
+            novelo.criarRastro({i, 1});
+            Bancada::naoOtimizar(novelo.topo());
+            novelo.puxarRastro();
+        }
+        Bancada::naoOtimizar(novelo);
+    });
+
+    if (bancada.selecionado("prisioneiro/dfs_corredor/" + n)) {
+        Grafo corredor;
+        corredor.setNumVertices(SALAS);
+        for (int v = 1; v < SALAS; ++v) corredor.adicionar_aresta(v - 1, v, 1);
+        corredor.compactar();
+        bancada.medir("prisioneiro/dfs_corredor/" + n, 2LL * (SALAS - 1), 3, [&] {
+            Bancada::naoOtimizar(explorar(corredor, SALAS));
+        });
+    }
+
+    // Estrela: a sala central tem grau GRAU_ESTRELA e é revisitada após cada ponta
+    const std::string g = std::to_string(GRAU_ESTRELA);
+    if (bancada.selecionado("prisioneiro/dfs_estrela/" + g)) {
+        Grafo estrela;
+        estrela.setNumVertices(GRAU_ESTRELA + 1);
+        for (int v = 1; v <= GRAU_ESTRELA; ++v) estrela.adicionar_aresta(0, v, 1);
+        estrela.compactar();
+        bancada.medir("prisioneiro/dfs_estrela/" + g, 2LL * GRAU_ESTRELA, 3, [&] {
+            Bancada::naoOtimizar(explorar(estrela, GRAU_ESTRELA + 1));
+        });
+    }
+
+    // Aresta mais barata na estrela: cada volta ao centro compara todos os vizinhos
+    // restantes (operação = vizinho examinado)
+    if (bancada.selecionado("prisioneiro/barata_estrela/" + g)) {
+        Grafo estrela;
+        estrela.setNumVertices(GRAU_ESTRELA + 1);
+        for (int v = 1; v <= GRAU_ESTRELA; ++v) estrela.adicionar_aresta(0, v, 1 + v % 2);
+        estrela.compactar();
+        const long long examinados = 1LL * GRAU_ESTRELA * (GRAU_ESTRELA + 1) / 2;
+        bancada.medir("prisioneiro/barata_estrela/" + g, examinados, 3, [&] {
+            Bancada::naoOtimizar(explorar(estrela, GRAU_ESTRELA + 1, PoliticaExploracao::ARESTA_MAIS_BARATA));
+        });
+    }
+
+    if (bancada.selecionado("prisioneiro/dfs_pente/" + n)) {
+        Grafo pente;
+        pente.setNumVertices(SALAS);
+        const int espinha = SALAS / 2;
+        for (int v = 0; v < espinha; ++v) {
+            pente.adicionar_aresta(v, espinha + v, 1);   // dente: beco sem saída
+            if (v + 1 < espinha) pente.adicionar_aresta(v, v + 1, 1);
+        }
+        pente.compactar();
+        bancada.medir("prisioneiro/dfs_pente/" + n, 2LL * (SALAS - 1), 3, [&] {
+            Bancada::naoOtimizar(explorar(pente, SALAS));
+        });
+    }
+}
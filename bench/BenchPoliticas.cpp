@@ -0,0 +1,84 @@
+/**
+ * @file BenchPoliticas.cpp
+ * @brief Compara as políticas de exploração do prisioneiro em labirintos gerados.
+ * @details Cada caso roda `Simulador::run` em LABIRINTOS cenários aleatórios com
+ * SEEDS seeds cada. O tempo é dado por evento simulado (movimento do prisioneiro
+ * ou do Minotauro) e inclui o preparo de cada `run` (Floyd-Warshall da memória do
+ * Minotauro), como numa execução real; o JSON também traz a taxa de sobrevivência
+ * e os eventos por segundo de cada política.
+ */
+
+#include "Benchmarks.h"
+#include "GeradorLabirintos.h"
+#include "labirinto/Simulador.h"
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int SALAS = 200;
+constexpr int EXTRAS = 100;
+constexpr int KITS = 300;
+constexpr int PERCEPCAO = 3;
+constexpr int LABIRINTOS = 6;
+constexpr int SEEDS = 16;
+constexpr int CHANCE = 30;
+
+struct Politica {
+    const char* nome;
+    PoliticaExploracao politica;
+};
+
+const Politica POLITICAS[] = {
+    {"dfs", PoliticaExploracao::DFS},
+    {"barata", PoliticaExploracao::ARESTA_MAIS_BARATA},
+    {"aleatoria", PoliticaExploracao::ALEATORIA},
+    {"comida", PoliticaExploracao::CONSCIENTE_DA_COMIDA},
+};
+
+// Executa todas as seeds em todos os cenários; retorna o número de eventos
+long long rodada(std::vector<std::unique_ptr<Simulador>>& cenarios, int& sobreviventes) {
+    long long eventos = 0;
+    sobreviventes = 0;
+    for (auto& simulador : cenarios) {
+        for (int seed = 1; seed <= SEEDS; ++seed) {
+            Simulador::ResultadoSimulacao r = simulador->run(static_cast<unsigned int>(seed), CHANCE);
+            eventos += static_cast<long long>(r.caminhoP.tamanho() + r.caminhoM.size());
+            sobreviventes += r.prisioneiroSobreviveu;
+        }
+    }
+    return eventos;
+}
+
+} // namespace
+
+void benchPoliticas(Bancada& bancada) {
+    for (const Politica& politica : POLITICAS) {
+        const std::string nome = std::string("politicas/") + politica.nome + "/" + std::to_string(SALAS);
+        if (!bancada.selecionado(nome)) continue;
+
+        std::vector<std::unique_ptr<Simulador>> cenarios;
+        for (int i = 0; i < LABIRINTOS; ++i) {
+            std::istringstream texto(gerarLabirinto(SALAS, EXTRAS, KITS, PERCEPCAO, 1000u + i));
+            auto simulador = std::make_unique<Simulador>();
+            if (!simulador->carregar(texto, "gerado")) return;
+            simulador->setPoliticaPrisioneiro(politica.politica, 7u + i);
+            cenarios.push_back(std::move(simulador));
+        }
+
+        // Rodada de aquecimento: conta os eventos e a taxa de sobrevivência
+        int sobreviventes = 0;
+        const long long eventos = rodada(cenarios, sobreviventes);
+        bancada.medir(nome, eventos, 3, [&] {
+            int s = 0;
+            Bancada::naoOtimizar(rodada(cenarios, s));
+        });
+
+        if (const Bancada::Medida* m = bancada.medida(nome)) {
+            bancada.anotar(nome, "taxaSobrevivencia", static_cast<double>(sobreviventes) / (LABIRINTOS * SEEDS));
+            bancada.anotar(nome, "eventosPorSegundo", 1e9 / m->melhorNs);
+        }
+    }
+}
@@ -0,0 +1,49 @@
+/**
+ * @file BenchRegistro.cpp
+ * @brief Custo do registro da jornada (`NivelRegistro`) em execuções curtas.
+ * @details Em lotes de muitas seeds sobre um labirinto pequeno, gravar rastros e
+ * linha do tempo pode pesar tanto quanto a simulação; cada caso executa as mesmas
+ * SEEDS simulações com um nível de registro e mede o tempo por simulação.
+ */
+
+#include "Benchmarks.h"
+#include "GeradorLabirintos.h"
+#include "labirinto/Simulador.h"
+#include <sstream>
+#include <string>
+
+namespace {
+
+constexpr int SALAS = 24;
+constexpr int SEEDS = 2000;
+
+struct Nivel {
+    const char* nome;
+    NivelRegistro nivel;
+};
+
+const Nivel NIVEIS[] = {
+    {"desligado", NivelRegistro::DESLIGADO},
+    {"resumo", NivelRegistro::RESUMO},
+    {"completo", NivelRegistro::COMPLETO},
+};
+
+} // namespace
+
+void benchRegistro(Bancada& bancada) {
+    for (const Nivel& nivel : NIVEIS) {
+        const std::string nome = std::string("registro/") + nivel.nome + "/" + std::to_string(SEEDS);
+        if (!bancada.selecionado(nome)) continue;
+
+        Simulador simulador;
+        std::istringstream texto(gerarLabirinto(SALAS, SALAS / 2, 4 * SALAS, 2, 42u));
+        if (!simulador.carregar(texto, "gerado")) return;
+        simulador.setNivelRegistro(nivel.nivel);
+
+        bancada.medir(nome, SEEDS, 5, [&] {
+            for (int seed = 1; seed <= SEEDS; ++seed) {
+                Bancada::naoOtimizar(simulador.run(static_cast<unsigned int>(seed), 30));
+            }
+        });
+    }
+}
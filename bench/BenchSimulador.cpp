@@ -0,0 +1,195 @@
+/**
+ * @file BenchSimulador.cpp
+ * @brief Benchmarks de ponta a ponta: carga, memória do Minotauro, simulação e relatório.
+ * @details
+ * - `carregar/arquivo/<salas>`: `Simulador::carregarArquivo` sobre um cenário gerado e
+ *   gravado no diretório temporário (tempo por corredor lido).
+ * - `minotauro/lembrarCaminhos/<V>`: Floyd–Warshall de V = 256, 512 e 1024 (tempo por
+ *   V^3); 2048, 4096 e 8192 só quando o tamanho é pedido no filtro (ex.:
+ *   `--filtro lembrarCaminhos/4096`), pois levam de segundos a minutos.
+ * - `simulador/run/<salas>`: `Simulador::run` completo (com a memória do Minotauro),
+ *   tempo por simulação.
+ * - `simulador/lote/{sequencial,pista_a_pista,lockstep}/<seeds>`: as mesmas seeds no
+ *   labirinto de `simulador/run`, por `Simulador::run` uma a uma (só as 32 primeiras),
+ *   pelo `SimuladorLote` com uma pista por chamada e pelo lote com todas as pistas em
+ *   lockstep (as duas últimas sobre a mesma memória do Minotauro), tempo por seed. O
+ *   caso lockstep anota a aceleração sobre os outros dois; resultados divergentes de
+ *   `run` falham a bancada.
+ * - `logger/progresso/<eventos>`: `Logger::printarLogsComProgresso` com a animação
+ *   desligada (LAB_ANIM_DELAY_MS=0) e a saída descartada, tempo por evento.
+ * - `saida/jsonCompleto/<eventos>`: `imprimirJson` com rastros e linha do tempo
+ *   (`--json-full`) de um resultado sintético, num fluxo em memória, tempo por evento.
+ */
+
+#include "Benchmarks.h"
+#include "GeradorLabirintos.h"
+#include "labirinto/Grafo.h"
+#include "labirinto/Minotauro.h"
+#include "labirinto/SaidaJson.h"
+#include "labirinto/Simulador.h"
+#include "labirinto/SimuladorLote.h"
+#include "utils/Logger.h"
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int SALAS_RUN = 300;
+constexpr int SEEDS_RUN = 20;
+constexpr int SEEDS_LOTE = 256;
+constexpr int SEEDS_SEQUENCIAL = 32; // Simulador::run refaz o Floyd–Warshall a cada seed
+
+void benchCarregar(Bancada& bancada) {
+    for (int salas : {1000, 100000}) {
+        const std::string nome = "carregar/arquivo/" + std::to_string(salas);
+        if (!bancada.selecionado(nome)) continue;
+        const std::filesystem::path arquivo =
+            std::filesystem::temp_directory_path() / ("labirinto_bench_" + std::to_string(salas) + ".txt");
+        {
+            std::ofstream saida(arquivo);
+            saida << gerarLabirinto(salas, salas / 2, 4 * salas, 2, 7u);
+        }
+        const long long corredores = salas - 1 + salas / 2;
+        bancada.medir(nome, corredores, 5, [&] {
+            Simulador simulador;
+            Bancada::naoOtimizar(simulador.carregarArquivo(arquivo.string()));
+        });
+        std::filesystem::remove(arquivo);
+    }
+}
+
+void benchLembrarCaminhos(Bancada& bancada) {
+    for (int salas : {256, 512, 1024, 2048, 4096, 8192}) {
+        const std::string n = std::to_string(salas);
+        const std::string nome = "minotauro/lembrarCaminhos/" + n;
+        if (!bancada.selecionado(nome) || (salas > 1024 && !bancada.explicito(n))) continue;
+        Grafo grafo;
+        gerarGrafo(grafo, salas, salas / 2, 11u);
+        const long long cubo = 1LL * salas * salas * salas;
+        bancada.medir(nome, cubo, salas > 1024 ? 1 : 3, [&] {
+            Minotauro minotauro(0, 1, grafo, salas);
+            minotauro.lembrarCaminhos();
+            Bancada::naoOtimizar(minotauro);
+        });
+    }
+}
+
+void benchRun(Bancada& bancada) {
+    const std::string nome = "simulador/run/" + std::to_string(SALAS_RUN);
+    if (!bancada.selecionado(nome)) return;
+    Simulador simulador;
+    std::istringstream texto(gerarLabirinto(SALAS_RUN, SALAS_RUN / 2, 4 * SALAS_RUN, 3, 5u));
+    if (!simulador.carregar(texto, "gerado")) return;
+    bancada.medir(nome, SEEDS_RUN, 3, [&] {
+        for (int seed = 1; seed <= SEEDS_RUN; ++seed) {
+            Bancada::naoOtimizar(simulador.run(static_cast<unsigned int>(seed), 30));
+        }
+    });
+}
+
+void benchLote(Bancada& bancada) {
+    const std::string k = std::to_string(SEEDS_LOTE);
+    if (!bancada.selecionado("simulador/lote/")) return;
+    Simulador simulador;
+    std::istringstream texto(gerarLabirinto(SALAS_RUN, SALAS_RUN / 2, 4 * SALAS_RUN, 3, 5u));
+    if (!simulador.carregar(texto, "gerado")) return;
+    const std::unique_ptr<Minotauro> memoria = simulador.calcularMemoriaMinotauro();
+    std::vector<unsigned int> seeds(SEEDS_LOTE);
+    for (int i = 0; i < SEEDS_LOTE; ++i) seeds[i] = static_cast<unsigned int>(i + 1);
+
+    std::vector<Simulador::ResultadoSimulacao> sequencial;
+    bancada.medir("simulador/lote/sequencial/" + k, SEEDS_SEQUENCIAL, 1, [&] {
+        sequencial.clear();
+        for (int i = 0; i < SEEDS_SEQUENCIAL; ++i) sequencial.push_back(simulador.run(seeds[i], 30));
+    });
+    bancada.medir("simulador/lote/pista_a_pista/" + k, SEEDS_LOTE, 3, [&] {
+        SimuladorLote lote(simulador, *memoria);
+        for (unsigned int seed : seeds) Bancada::naoOtimizar(lote.run(std::vector<unsigned int>{seed}, 30));
+    });
+    std::vector<Simulador::ResultadoSimulacao> lockstep;
+    const std::string nome = "simulador/lote/lockstep/" + k;
+    bancada.medir(nome, SEEDS_LOTE, 5, [&] {
+        SimuladorLote lote(simulador, *memoria);
+        lockstep = lote.run(seeds, 30);
+    });
+
+    if (!sequencial.empty() && !lockstep.empty()) {
+        for (int i = 0; i < SEEDS_SEQUENCIAL; ++i) {
+            if (!SimuladorLote::resultadosIguais(sequencial[i], lockstep[i])) {
+                bancada.falhar(nome + ": seed " + std::to_string(seeds[i]) + " diverge de Simulador::run");
+                break;
+            }
+        }
+    }
+    const Bancada::Medida* medidaLockstep = bancada.medida(nome);
+    const std::pair<const char*, const char*> comparacoes[] = {{"sequencial", "aceleracaoSobreRun"},
+                                                               {"pista_a_pista", "aceleracaoSobrePistaAPista"}};
+    for (const auto& [caso, chave] : comparacoes) {
+        const Bancada::Medida* outra = bancada.medida("simulador/lote/" + std::string(caso) + "/" + k);
+        if (medidaLockstep && outra) bancada.anotar(nome, chave, outra->medianaNs / medidaLockstep->medianaNs);
+    }
+}
+
+void benchProgresso(Bancada& bancada) {
+    if (!bancada.selecionado("logger/progresso/")) return;
+    Simulador simulador;
+    std::istringstream texto(gerarLabirinto(400, 200, 4000, 1, 3u));
+    if (!simulador.carregar(texto, "gerado")) return;
+    simulador.setNivelRegistro(NivelRegistro::COMPLETO);
+    const auto resultado = simulador.run(1u, 100); // o prisioneiro vence o encontro e segue explorando
+    const std::string nome = "logger/progresso/" + std::to_string(resultado.eventos.size());
+    if (!bancada.selecionado(nome) || resultado.eventos.empty()) return;
+
+    setenv("LAB_ANIM_DELAY_MS", "0", 1);
+    std::ostringstream descarte;
+    bancada.medir(nome, static_cast<long long>(resultado.eventos.size()), 3, [&] {
+        descarte.str("");
+        std::streambuf* original = std::cout.rdbuf(descarte.rdbuf());
+        Logger::printarLogsComProgresso(resultado.eventos, resultado.tempoReal, resultado.tempoEncontro,
+                                        resultado.tipoEncontro, "");
+        std::cout.rdbuf(original);
+    });
+}
+
+void benchSaidaJson(Bancada& bancada) {
+    constexpr int EVENTOS = 1000000;
+    const std::string nome = "saida/jsonCompleto/" + std::to_string(EVENTOS);
+    if (!bancada.selecionado(nome)) return;
+
+    // Um passeio longo: um evento e uma sala de cada rastro por movimento
+    Simulador::ResultadoSimulacao resultado{};
+    resultado.motivoFim = "O prisioneiro morreu de fome no dia " + std::to_string(EVENTOS) + ".";
+    resultado.eventos.reserve(EVENTOS);
+    for (int i = 0; i < EVENTOS; ++i) {
+        const bool prisioneiro = i % 2 == 0;
+        const int sala = static_cast<int>((i * 7919LL) % 100000);
+        if (prisioneiro) resultado.caminhoP.adicionar(sala);
+        else resultado.caminhoM.push_back(sala);
+        resultado.eventos.push_back(Logger::EventoMovimento{i * 0.5, i * 0.5 + 1.5, prisioneiro ? "Prisioneiro" : "Minotauro",
+                                                            sala, (sala + 1) % 100000, 1 + i % 9});
+    }
+
+    std::ostringstream saida;
+    bancada.medir(nome, EVENTOS, 5, [&] {
+        saida.str("");
+        imprimirJson(saida, resultado, nullptr, false, nullptr, nullptr, "", true);
+        Bancada::naoOtimizar(saida.tellp());
+    });
+}
+
+} // namespace
+
+void benchSimulador(Bancada& bancada) {
+    benchCarregar(bancada);
+    benchLembrarCaminhos(bancada);
+    benchRun(bancada);
+    benchLote(bancada);
+    benchProgresso(bancada);
+    benchSaidaJson(bancada);
+}
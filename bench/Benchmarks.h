@@ -0,0 +1,23 @@
+/**
+ * @file Benchmarks.h
+ * @brief Declaração dos grupos de benchmarks executados por `labirinto_bench`.
+ */
+
+#pragma once
+
+#include "Bancada.h"
+
+/// @brief Novelo (pilha do backtracking) e DFS profunda do prisioneiro.
+void benchNovelo(Bancada& bancada);
+/// @brief Políticas de exploração do prisioneiro: sobrevivência e eventos por segundo.
+void benchPoliticas(Bancada& bancada);
+/// @brief Custo de cada nível de registro da jornada em execuções curtas.
+void benchRegistro(Bancada& bancada);
+/// @brief Vazão de `extrairMin` do heap de Fibonacci (10^7 elementos).
+void benchFibHeap(Bancada& bancada);
+/// @brief Dijkstra com cada fila de prioridade em labirintos de 10^4 a 10^6 salas.
+void benchFilas(Bancada& bancada);
+/// @brief Mudanças de corredor (`Grafo::definirPeso`) na forma compacta, em 10^3 e 10^5 salas.
+void benchGrafo(Bancada& bancada);
+/// @brief Carga de arquivos, Floyd–Warshall do Minotauro, `Simulador::run`, relatório de progresso e JSON completo.
+void benchSimulador(Bancada& bancada);
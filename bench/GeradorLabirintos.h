@@ -0,0 +1,99 @@
+/**
+ * @file GeradorLabirintos.h
+ * @brief Gerador determinístico de cenários para os benchmarks.
+ * @details Produz o texto de um cenário no mesmo formato dos arquivos em `data/`,
+ * para ser lido por `Simulador::carregar` sem passar pelo disco, ou monta
+ * diretamente um Grafo grande (milhões de salas) sem o texto intermediário.
+ */
+
+#pragma once
+
+#include "labirinto/Grafo.h"
+#include <random>
+#include <sstream>
+#include <string>
+
+/**
+ * @brief Gera um labirinto conexo aleatório.
+ * @details Uma árvore geradora (cada sala liga-se a uma sala anterior sorteada)
+ * mais `extras` corredores sorteados, com pesos de 1 a 9. A entrada é a sala 0, a
+ * saída a última sala e o Minotauro começa no meio.
+ * @param salas Quantidade de salas (>= 2).
+ * @param extras Corredores além da árvore geradora.
+ * @param kits Kits de comida do prisioneiro.
+ * @param percepcao Percepção do Minotauro.
+ * @param seed Semente do gerador; a mesma seed gera o mesmo cenário.
+ * @return O texto do cenário.
+ */
+inline std::string gerarLabirinto(int salas, int extras, int kits, int percepcao, unsigned int seed) {
+    std::mt19937 gerador(seed);
+    std::uniform_int_distribution<int> peso(1, 9);
+    std::ostringstream saida;
+    saida << salas << '\n' << (salas - 1 + extras) << '\n';
+    for (int v = 1; v < salas; ++v) {
+        saida << std::uniform_int_distribution<int>(0, v - 1)(gerador) << ' ' << v << ' ' << peso(gerador) << '\n';
+    }
+    std::uniform_int_distribution<int> sala(0, salas - 1);
+    for (int i = 0; i < extras; ++i) {
+        int u = sala(gerador);
+        int v = sala(gerador);
+        if (u == v) v = (v + 1) % salas;
+        saida << u << ' ' << v << ' ' << peso(gerador) << '\n';
+    }
+    saida << 0 << '\n' << (salas - 1) << '\n' << (salas / 2) << '\n' << percepcao << '\n' << kits << '\n';
+    return saida.str();
+}
+
+/**
+ * @brief Monta diretamente no Grafo o mesmo tipo de labirinto de `gerarLabirinto`.
+ * @details Árvore geradora aleatória mais `extras` corredores, pesos de 1 a 9 e
+ * saída na última sala. O grafo já sai compactado.
+ * @param grafo O grafo a preencher (deve estar vazio).
+ * @param salas Quantidade de salas (>= 2).
+ * @param extras Corredores além da árvore geradora.
+ * @param seed Semente do gerador.
+ */
+inline void gerarGrafo(Grafo& grafo, int salas, int extras, unsigned int seed) {
+    std::mt19937 gerador(seed);
+    std::uniform_int_distribution<int> peso(1, 9);
+    grafo.setNumVertices(salas);
+    for (int v = 1; v < salas; ++v) {
+        grafo.adicionar_aresta(std::uniform_int_distribution<int>(0, v - 1)(gerador), v, peso(gerador));
+    }
+    std::uniform_int_distribution<int> sala(0, salas - 1);
+    for (int i = 0; i < extras; ++i) {
+        int u = sala(gerador);
+        int v = sala(gerador);
+        if (u == v) v = (v + 1) % salas;
+        grafo.adicionar_aresta(u, v, peso(gerador));
+    }
+    grafo.setNumArestas(salas - 1 + extras);
+    grafo.set_saida(salas - 1);
+    grafo.compactar();
+}
+
+/**
+ * @brief Monta um labirinto em grade `lado` x `lado` com pesos de 1 a 9.
+ * @details Cada sala liga-se à da direita e à de baixo: um grafo esparso (grau <= 4)
+ * e conexo, com distâncias inteiras, como os labirintos de `data/` em escala grande.
+ * O grafo já sai compactado.
+ * @param grafo O grafo a preencher (deve estar vazio).
+ * @param lado O número de salas por linha.
+ * @param seed Semente do gerador dos pesos.
+ */
+inline void gerarGrade(Grafo& grafo, int lado, unsigned int seed) {
+    std::mt19937 gerador(seed);
+    std::uniform_int_distribution<int> peso(1, 9);
+    grafo.setNumVertices(lado * lado);
+    int arestas = 0;
+    for (int l = 0; l < lado; ++l) {
+        for (int c = 0; c < lado; ++c) {
+            const int sala = l * lado + c;
+            if (c + 1 < lado) { grafo.adicionar_aresta(sala, sala + 1, peso(gerador)); arestas++; }
+            if (l + 1 < lado) { grafo.adicionar_aresta(sala, sala + lado, peso(gerador)); arestas++; }
+        }
+    }
+    grafo.setNumArestas(arestas);
+    grafo.set_saida(lado * lado - 1);
+    grafo.compactar();
+}
@@ -0,0 +1,73 @@
+/**
+ * @file main.cpp
+ * @brief Ponto de entrada de `labirinto_bench`.
+ * @details Uso: `labirinto_bench [--filtro <trecho>] [--json <arquivo>]`. Sem
+ * `--json`, o JSON é impresso ao final da saída padrão.
+ *
+ * `labirinto_bench --gerar <salas> <seed> <arquivo>` apenas grava um cenário gerado
+ * por `gerarLabirinto` (os mesmos parâmetros de `carregar/arquivo`), usado pelos
+ * testes de desempenho (`tests/perf`).
+ *
+ * Sai com código 1 se alguma verificação da bancada falhar (ex.: filas de prioridade
+ * com distâncias divergentes), mesmo com as medidas gravadas.
+ */
+
+#include "Benchmarks.h"
+#include "GeradorLabirintos.h"
+#include "utils/Logger.h"
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+int main(int argc, char* argv[]) {
+    if (argc == 5 && std::string(argv[1]) == "--gerar") {
+        const int salas = std::atoi(argv[2]);
+        if (salas < 2) {
+            std::cerr << "--gerar requer ao menos 2 salas" << std::endl;
+            return 1;
+        }
+        std::ofstream saida(argv[4]);
+        if (!saida) {
+            std::cerr << "Não foi possível abrir " << argv[4] << std::endl;
+            return 1;
+        }
+        saida << gerarLabirinto(salas, salas / 2, 4 * salas, 2, static_cast<unsigned int>(std::strtoul(argv[3], nullptr, 10)));
+        return 0;
+    }
+
+    std::string filtro;
+    std::string arquivoJson;
+    for (int i = 1; i < argc; ++i) {
+        std::string flag = argv[i];
+        if (flag == "--filtro" && i + 1 < argc) filtro = argv[++i];
+        else if (flag == "--json" && i + 1 < argc) arquivoJson = argv[++i];
+        else {
+            std::cerr << "Uso: " << argv[0] << " [--filtro <trecho>] [--json <arquivo>]" << std::endl;
+            std::cerr << "     " << argv[0] << " --gerar <salas> <seed> <arquivo>" << std::endl;
+            return 1;
+        }
+    }
+
+    Logger::setLevel(LogLevel::ERROR); // os casos medidos não devem imprimir logs
+    Bancada bancada(filtro);
+    benchNovelo(bancada);
+    benchPoliticas(bancada);
+    benchRegistro(bancada);
+    benchFibHeap(bancada);
+    benchFilas(bancada);
+    benchGrafo(bancada);
+    benchSimulador(bancada);
+
+    if (arquivoJson.empty()) {
+        bancada.salvarJson(std::cout);
+    } else {
+        std::ofstream saida(arquivoJson);
+        if (!saida) {
+            std::cerr << "Não foi possível abrir " << arquivoJson << std::endl;
+            return 1;
+        }
+        bancada.salvarJson(saida);
+    }
+    return bancada.getFalhas() ? 1 : 0;
+}
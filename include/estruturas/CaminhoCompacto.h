@@ -0,0 +1,125 @@
+/**
+ * @file CaminhoCompacto.h
+ * @brief Definição da classe CaminhoCompacto, uma sequência de salas codificada em bytes.
+ * @details Este arquivo contém o buffer usado para gravar o rastro do prisioneiro:
+ * cada sala é guardada como a diferença para a sala anterior, em zigzag e varint.
+ */
+
+#ifndef CAMINHO_COMPACTO_H
+#define CAMINHO_COMPACTO_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class CaminhoCompacto
+ * @brief Sequência de inteiros gravada como deltas em varint.
+ * @details Salas vizinhas costumam ter índices próximos, então cada passo ocupa
+ * em geral 1 ou 2 bytes em vez dos 4 de um `int`. O buffer só cresce (sem
+ * alocação por passo além do crescimento geométrico do vetor) e pode ser movido
+ * para o resultado da simulação sem cópia. A leitura é sequencial: `paraCada`
+ * percorre os valores na ordem de gravação e `decodificar` os expande em um vetor.
+ */
+class CaminhoCompacto {
+private:
+    /// @brief Os deltas codificados (7 bits por byte, bit alto indica continuação).
+    std::vector<uint8_t> bytes;
+    /// @brief Quantidade de valores gravados.
+    size_t numValores = 0;
+    /// @brief Último valor gravado (base do próximo delta).
+    int ultimo = 0;
+
+public:
+    /**
+     * @brief Reserva espaço para `bytes` bytes codificados.
+     * @param capacidade A quantidade de bytes a reservar.
+     */
+    void reservar(size_t capacidade) {
+        bytes.reserve(capacidade);
+    }
+
+    /**
+     * @brief Grava um valor no fim da sequência.
+     * @param valor O valor (por exemplo, o índice de uma sala).
+     */
+    void adicionar(int valor) {
+        const int64_t delta = static_cast<int64_t>(valor) - ultimo;
+        uint64_t z = (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63);
+        while (z >= 0x80) {
+            bytes.push_back(static_cast<uint8_t>(z) | 0x80);
+            z >>= 7;
+        }
+        bytes.push_back(static_cast<uint8_t>(z));
+        ultimo = valor;
+        numValores++;
+    }
+
+    /**
+     * @brief Percorre os valores na ordem de gravação.
+     * @param visitar Chamado com cada valor (`void(int)`).
+     */
+    template <typename F>
+    void paraCada(F&& visitar) const {
+        int valor = 0;
+        size_t i = 0;
+        while (i < bytes.size()) {
+            uint64_t z = 0;
+            int deslocamento = 0;
+            uint8_t b;
+            do {
+                b = bytes[i++];
+                z |= static_cast<uint64_t>(b & 0x7F) << deslocamento;
+                deslocamento += 7;
+            } while (b & 0x80);
+            const int64_t delta = static_cast<int64_t>(z >> 1) ^ -static_cast<int64_t>(z & 1);
+            valor = static_cast<int>(valor + delta);
+            visitar(valor);
+        }
+    }
+
+    /**
+     * @brief Expande a sequência em um vetor de inteiros.
+     * @return Os valores na ordem de gravação.
+     */
+    std::vector<int> decodificar() const {
+        std::vector<int> valores;
+        valores.reserve(numValores);
+        paraCada([&](int v) { valores.push_back(v); });
+        return valores;
+    }
+
+    /**
+     * @brief Remove todos os valores, mantendo a capacidade reservada.
+     */
+    void limpar() {
+        bytes.clear();
+        numValores = 0;
+        ultimo = 0;
+    }
+
+    /**
+     * @brief Obtém a quantidade de valores gravados.
+     * @return O número de valores.
+     */
+    size_t tamanho() const {
+        return numValores;
+    }
+
+    /**
+     * @brief Verifica se a sequência está vazia.
+     * @return `true` se nenhum valor foi gravado.
+     */
+    bool vazio() const {
+        return numValores == 0;
+    }
+
+    /**
+     * @brief Obtém o tamanho do buffer codificado.
+     * @return A quantidade de bytes usados.
+     */
+    size_t bytesUsados() const {
+        return bytes.size();
+    }
+};
+
+#endif
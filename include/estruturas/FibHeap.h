@@ -3,18 +3,43 @@
 
 #include "FibNo.h"
 #include <vector>
-#include <cmath>
+#include <memory>
 #include <iostream>
 #include <stdexcept> // Para runtime_error
 #include <algorithm> // Para swap
 
 
+// Heap de Fibonacci com handles estáveis.
+// Os nós vêm de uma arena própria do heap (blocos de tamanho crescente) e os nós
+// extraídos voltam para uma lista livre, então inserir não aloca depois que a
+// arena cresce até o tamanho de trabalho. O handle devolvido por inserir vale até
+// o nó ser extraído (depois disso ele é reaproveitado).
 template <typename T>
 class FibHeap {
+public:
+    using Handle = FibNo<T>*;
+    static constexpr Handle NULO = nullptr;
+
 private:
     FibNo<T>* minNo; // Ponteiro para a raiz com a menor chave
     int numNos;      // Número total de nós no heap
 
+    // Arena: blocos[k] tem BLOCO_INICIAL << k nós; a alocação avança em (blocoAtual, usados)
+    static constexpr size_t BLOCO_INICIAL = 64;
+    std::vector<std::unique_ptr<FibNo<T>[]>> blocos;
+    size_t blocoAtual = 0;
+    size_t usados = 0;
+    FibNo<T>* livres = nullptr; // lista livre, encadeada por `direita`
+    // Blocos recebidos em unir (com seus tamanhos): pertencem a este heap, mas não
+    // entram na alocação sequencial; limpar devolve os seus nós à lista livre
+    std::vector<std::pair<std::unique_ptr<FibNo<T>[]>, size_t>> blocosAdotados;
+
+    // Tabela de graus de consolidar, mantida vazia entre chamadas e só cresce
+    std::vector<FibNo<T>*> tabelaGraus;
+
+    FibNo<T>* novoNo(const T& valor);
+    void liberarNo(FibNo<T>* no);
+
     void consolidar();
     void linkar(FibNo<T>* y, FibNo<T>* x);
     void cortar(FibNo<T>* x, FibNo<T>* y);
@@ -23,19 +48,72 @@ private:
 
 public:
     FibHeap() : minNo(nullptr), numNos(0) {}
-    ~FibHeap();
+    ~FibHeap() = default; // a arena libera todos os nós de uma vez: O(n)
+
+    FibHeap(const FibHeap&) = delete;
+    FibHeap& operator=(const FibHeap&) = delete;
 
     bool ehVazio() const { return minNo == nullptr; }
     int getTamanho() const { return numNos; }
     const T& getMin() const;
 
-    void inserir(const T& key);
+    Handle inserir(const T& key);
     T extrairMin();
-    void diminuirChave(FibNo<T>* no, const T& novoValor);
+    void diminuirChave(Handle no, const T& novoValor);
 
     void unir(FibHeap<T>& outroHeap);
+
+    // Esvazia o heap mantendo a arena para as próximas inserções.
+    // Custo: O(blocos), ou O(n) se houver blocos adotados em unir
+    void limpar();
 };
 
+// Obtém um nó da lista livre ou do próximo espaço da arena. Custo: O(1) amortizado
+template <typename T>
+FibNo<T>* FibHeap<T>::novoNo(const T& valor) {
+    FibNo<T>* no = livres;
+    if (no != nullptr) {
+        livres = no->direita;
+    } else {
+        if (blocoAtual < blocos.size() && usados == (BLOCO_INICIAL << blocoAtual)) {
+            blocoAtual++;
+            usados = 0;
+        }
+        if (blocoAtual == blocos.size()) {
+            blocos.emplace_back(new FibNo<T>[BLOCO_INICIAL << blocoAtual]);
+        }
+        no = &blocos[blocoAtual][usados++];
+    }
+    no->chave = valor;
+    no->grau = 0;
+    no->marcado = false;
+    no->pai = nullptr;
+    no->filho = nullptr;
+    no->esquerda = no;
+    no->direita = no;
+    return no;
+}
+
+// Devolve um nó extraído para a lista livre. Custo: O(1)
+template <typename T>
+void FibHeap<T>::liberarNo(FibNo<T>* no) {
+    no->direita = livres;
+    livres = no;
+}
+
+template <typename T>
+void FibHeap<T>::limpar() {
+    minNo = nullptr;
+    numNos = 0;
+    blocoAtual = 0;
+    usados = 0;
+    livres = nullptr;
+    // Nós dos blocos adotados voltam a ser alocáveis pela lista livre
+    for (auto& [bloco, tamanho] : blocosAdotados) {
+        for (size_t i = 0; i < tamanho; ++i) liberarNo(&bloco[i]);
+    }
+}
+
 
 template <typename T>
 const T& FibHeap<T>::getMin() const {
@@ -43,39 +121,51 @@ const T& FibHeap<T>::getMin() const {
     return minNo->chave;
 }
 
-// Insere um nó. Custo: O(1)
+// Insere um nó e devolve o seu handle (para diminuirChave). Custo: O(1)
 template <typename T>
-void FibHeap<T>::inserir(const T& valor){
-    FibNo<T>* novoNo = new FibNo<T>(valor);
-    adicionarListaRaiz(novoNo);
-    if (minNo == nullptr || novoNo->chave < minNo->chave){
-        minNo = novoNo;
+typename FibHeap<T>::Handle FibHeap<T>::inserir(const T& valor){
+    FibNo<T>* no = novoNo(valor);
+    adicionarListaRaiz(no);
+    if (minNo == nullptr || no->chave < minNo->chave){
+        minNo = no;
     }
 
     numNos++;
+    return no;
 }
 
-// Junta um heap a este. Custo: O(1)
+// Junta um heap a este; os nós (e a arena) do outro passam a pertencer a este,
+// e o outro fica vazio. Custo: O(blocos do outro)
 template <typename T>
 void FibHeap<T>::unir(FibHeap& outroHeap) {
-    if (outroHeap.minNo == nullptr) return;
+    if (&outroHeap == this || outroHeap.minNo == nullptr) return;
+    for (size_t k = 0; k < outroHeap.blocos.size(); ++k) {
+        blocosAdotados.emplace_back(std::move(outroHeap.blocos[k]), BLOCO_INICIAL << k);
+    }
+    for (auto& adotado : outroHeap.blocosAdotados) blocosAdotados.push_back(std::move(adotado));
+    FibNo<T>* outroMin = outroHeap.minNo;
+    int outroNum = outroHeap.numNos;
+    outroHeap.blocos.clear();
+    outroHeap.blocosAdotados.clear();
+    outroHeap.limpar();
+
     if (minNo == nullptr) {
-        minNo = outroHeap.minNo;
-        numNos = outroHeap.numNos;
+        minNo = outroMin;
+        numNos = outroNum;
         return;
     }
 
     // Concatena as duas listas de raízes
-    minNo->direita->esquerda = outroHeap.minNo->esquerda;
-    outroHeap.minNo->esquerda->direita = minNo->direita;
-    minNo->direita = outroHeap.minNo;
-    outroHeap.minNo->esquerda = minNo;
+    minNo->direita->esquerda = outroMin->esquerda;
+    outroMin->esquerda->direita = minNo->direita;
+    minNo->direita = outroMin;
+    outroMin->esquerda = minNo;
 
     // Atualiza o mínimo
-    if (outroHeap.minNo->chave < minNo->chave) {
-        minNo = outroHeap.minNo;
+    if (outroMin->chave < minNo->chave) {
+        minNo = outroMin;
     }
-    numNos += outroHeap.numNos;
+    numNos += outroNum;
 }
 
 // Custo Amortizado: O(log n)
@@ -115,7 +205,7 @@ T FibHeap<T>::extrairMin() {
         consolidar();      
     }
     numNos--;
-    delete z;
+    liberarNo(z);
     return minValor;
 }
 
@@ -142,41 +232,55 @@ void FibHeap<T>::linkar(FibNo<T>* y, FibNo<T>* x) {
     y->marcado = false;
 }
 
-// Processo de reorganização
+// Processo de reorganização. Não aloca: a tabela de graus é do heap e a lista de
+// raízes é percorrida no próprio anel.
 template <typename T>
 void FibHeap<T>::consolidar() {
-    int grauMax = static_cast<int>(floor(log(numNos) / log(1.618)));
-    std::vector<FibNo<T>*> TabelaGraus(grauMax + 2, nullptr);
-
-    std::vector<FibNo<T>*> raizes;
     FibNo<T>* atual = minNo;
     if (atual == nullptr) return;
+
+    // Grau máximo <= log_phi(n) < 1.45 * log2(n), com log2(n) pelo comprimento em bits
+    // de numNos (que ainda conta o nó extraído)
+    int bits = 1;
+    while ((numNos >> bits) != 0) bits++;
+    const size_t tamanhoTabela = static_cast<size_t>(bits + bits / 2 + 2);
+    if (tabelaGraus.size() < tamanhoTabela) tabelaGraus.resize(tamanhoTabela, nullptr);
+
+    // Conta as raízes antes de ligar: ligar só remove do anel raízes já visitadas
+    // (as que estão na tabela), então as não visitadas seguem encadeadas
+    int numRaizes = 0;
     do {
-        raizes.push_back(atual);
+        numRaizes++;
         atual = atual->direita;
     } while (atual != minNo);
 
-    for (FibNo<T>* x : raizes) {
+    int grauMaximo = 0;
+    for (int r = 0; r < numRaizes; ++r) {
+        FibNo<T>* x = atual;
+        atual = atual->direita;
         int d = x->grau;
-        while (TabelaGraus[d] != nullptr) {
-            FibNo<T>* y = TabelaGraus[d];
+        while (tabelaGraus[d] != nullptr) {
+            FibNo<T>* y = tabelaGraus[d];
             if (x->chave > y->chave) {
                 std::swap(x, y);
             }
             linkar(y, x);
-            TabelaGraus[d] = nullptr;
+            tabelaGraus[d] = nullptr;
             d++;
         }
-        TabelaGraus[d] = x;
+        tabelaGraus[d] = x;
+        grauMaximo = std::max(grauMaximo, d);
     }
 
+    // As raízes restantes são exatamente as da tabela e já formam o anel
     minNo = nullptr;
-    for (size_t i = 0; i < TabelaGraus.size(); ++i) {
-        if (TabelaGraus[i] != nullptr) {
-            adicionarListaRaiz(TabelaGraus[i]);
-            if (minNo == nullptr || TabelaGraus[i]->chave < minNo->chave) {
-                minNo = TabelaGraus[i];
+    for (int i = 0; i <= grauMaximo; ++i) {
+        FibNo<T>* raiz = tabelaGraus[i];
+        if (raiz != nullptr) {
+            if (minNo == nullptr || raiz->chave < minNo->chave) {
+                minNo = raiz;
             }
+            tabelaGraus[i] = nullptr;
         }
     }
 }
@@ -199,7 +303,7 @@ void FibHeap<T>::adicionarListaRaiz(FibNo<T>* node) {
 
 // Diminuir Chave. Custo Amortizado: O(1)
 template <typename T>
-void FibHeap<T>::diminuirChave(FibNo<T>* no, const T& novoValor) {
+void FibHeap<T>::diminuirChave(Handle no, const T& novoValor) {
     if (novoValor > no->chave) {
         throw std::invalid_argument("Nova chave é maior que a chave atual.");
     }
@@ -250,11 +354,5 @@ void FibHeap<T>::corteCascata(FibNo<T>* y) {
     }
 }
 
-template<typename T>
-FibHeap<T>::~FibHeap() {
-    while(minNo != nullptr) {
-        extrairMin();
-    }
-}
 
 #endif 
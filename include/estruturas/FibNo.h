@@ -12,15 +12,20 @@ private:
     T chave;
     int grau;
     bool marcado;
-    FibNo<T>* pai;     
+    FibNo<T>* pai;
     FibNo<T>* filho;
     FibNo<T>* esquerda;
     FibNo<T>* direita;
 
-    FibNo(T k) : chave(k), grau(0), marcado(false), pai(nullptr), filho(nullptr), esquerda(this), direita(this) {}
+    // Nós nascem nos blocos da arena do heap e são reaproveitados pela lista livre
+    FibNo() : chave(), grau(0), marcado(false), pai(nullptr), filho(nullptr), esquerda(this), direita(this) {}
 
     // A linha mágica que resolve quase todos os erros:
-    friend class FibHeap<T>; 
+    friend class FibHeap<T>;
+
+public:
+    // Chave atual do nó (o handle devolvido por FibHeap::inserir)
+    const T& getChave() const { return chave; }
 };
 
-#endif
\ No newline at end of file
+#endif
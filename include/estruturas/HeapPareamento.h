@@ -0,0 +1,162 @@
+#ifndef HEAP_PAREAMENTO_H
+#define HEAP_PAREAMENTO_H
+
+#include <vector>
+#include <stdexcept> // Para runtime_error
+#include <utility>   // Para swap
+
+// Heap de pareamento (pairing heap) com handles estáveis.
+// Mesma interface do FibHeap. Os nós ficam em um vetor (o handle é o índice) e são
+// reaproveitados após a extração; extrairMin faz o pareamento em duas passadas
+// sobre a própria lista de filhos, sem memória auxiliar.
+template <typename T>
+class HeapPareamento {
+public:
+    using Handle = int;
+    static constexpr Handle NULO = -1;
+
+    HeapPareamento() = default;
+
+    bool ehVazio() const { return raiz == NULO; }
+    int getTamanho() const { return numNos; }
+    const T& getMin() const;
+
+    Handle inserir(const T& valor);
+    T extrairMin();
+    void diminuirChave(Handle h, const T& novoValor);
+
+    // Esvazia o heap mantendo a capacidade. Custo: O(1)
+    void limpar();
+
+private:
+    struct No {
+        T chave;
+        int filho;    // filho mais à esquerda
+        int irmao;    // próximo irmão à direita
+        int anterior; // irmão à esquerda, ou o pai se for o filho mais à esquerda
+    };
+
+    std::vector<No> nos;
+    int raiz = NULO;
+    int numNos = 0;
+    int livres = NULO; // lista livre, encadeada por `irmao`
+
+    // Junta duas árvores (raízes soltas); a de maior chave vira o filho mais à esquerda
+    int fundir(int a, int b);
+};
+
+template <typename T>
+const T& HeapPareamento<T>::getMin() const {
+    if (ehVazio()) throw std::runtime_error("Heap vazio");
+    return nos[raiz].chave;
+}
+
+// Custo: O(1)
+template <typename T>
+typename HeapPareamento<T>::Handle HeapPareamento<T>::inserir(const T& valor) {
+    int h;
+    if (livres != NULO) {
+        h = livres;
+        livres = nos[h].irmao;
+        nos[h] = No{valor, NULO, NULO, NULO};
+    } else {
+        h = static_cast<int>(nos.size());
+        nos.push_back(No{valor, NULO, NULO, NULO});
+    }
+    raiz = (raiz == NULO) ? h : fundir(raiz, h);
+    numNos++;
+    return h;
+}
+
+// Custo Amortizado: O(log n)
+template <typename T>
+T HeapPareamento<T>::extrairMin() {
+    if (ehVazio()) {
+        throw std::runtime_error("Heap está vazio");
+    }
+    const int z = raiz;
+    T minValor = nos[z].chave;
+
+    // 1ª passada: junta os filhos aos pares, da esquerda para a direita; os pares
+    // ficam encadeados por `irmao` em ordem inversa
+    int pares = NULO;
+    int atual = nos[z].filho;
+    while (atual != NULO) {
+        int a = atual;
+        int b = nos[a].irmao;
+        nos[a].anterior = NULO;
+        if (b == NULO) {
+            nos[a].irmao = pares;
+            pares = a;
+            break;
+        }
+        atual = nos[b].irmao;
+        nos[a].irmao = NULO;
+        nos[b].irmao = NULO;
+        nos[b].anterior = NULO;
+        int m = fundir(a, b);
+        nos[m].irmao = pares;
+        pares = m;
+    }
+
+    // 2ª passada: junta os pares da direita para a esquerda
+    raiz = NULO;
+    while (pares != NULO) {
+        int proximo = nos[pares].irmao;
+        nos[pares].irmao = NULO;
+        raiz = (raiz == NULO) ? pares : fundir(raiz, pares);
+        pares = proximo;
+    }
+
+    nos[z].irmao = livres;
+    livres = z;
+    numNos--;
+    return minValor;
+}
+
+// Corta a subárvore do nó e a junta à raiz. Custo Amortizado: O(log n)
+template <typename T>
+void HeapPareamento<T>::diminuirChave(Handle h, const T& novoValor) {
+    if (novoValor > nos[h].chave) {
+        throw std::invalid_argument("Nova chave é maior que a chave atual.");
+    }
+    nos[h].chave = novoValor;
+    if (h == raiz) return;
+
+    int ant = nos[h].anterior;
+    if (nos[ant].filho == h) {
+        nos[ant].filho = nos[h].irmao;
+    } else {
+        nos[ant].irmao = nos[h].irmao;
+    }
+    if (nos[h].irmao != NULO) {
+        nos[nos[h].irmao].anterior = ant;
+    }
+    nos[h].irmao = NULO;
+    nos[h].anterior = NULO;
+    raiz = fundir(raiz, h);
+}
+
+template <typename T>
+void HeapPareamento<T>::limpar() {
+    nos.clear();
+    raiz = NULO;
+    numNos = 0;
+    livres = NULO;
+}
+
+template <typename T>
+int HeapPareamento<T>::fundir(int a, int b) {
+    if (nos[b].chave < nos[a].chave) {
+        std::swap(a, b);
+    }
+    nos[b].irmao = nos[a].filho;
+    if (nos[a].filho != NULO) {
+        nos[nos[a].filho].anterior = b;
+    }
+    nos[b].anterior = a;
+    nos[a].filho = b;
+    return a;
+}
+
+#endif
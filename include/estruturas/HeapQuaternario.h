@@ -0,0 +1,142 @@
+#ifndef HEAP_QUATERNARIO_H
+#define HEAP_QUATERNARIO_H
+
+#include <vector>
+#include <stdexcept> // Para runtime_error
+#include <utility>
+#include <algorithm> // Para min
+
+// Heap 4-ário implícito (em vetor) com handles estáveis.
+// Mesma interface do FibHeap: inserir devolve um handle, diminuirChave usa o handle,
+// extrairMin e ehVazio. Cada nó tem 4 filhos: a árvore é mais rasa que a binária e
+// os filhos de um nó ficam na mesma linha de cache.
+template <typename T>
+class HeapQuaternario {
+public:
+    using Handle = int;
+    static constexpr Handle NULO = -1;
+
+    HeapQuaternario() = default;
+
+    bool ehVazio() const { return itens.empty(); }
+    int getTamanho() const { return static_cast<int>(itens.size()); }
+    const T& getMin() const;
+
+    Handle inserir(const T& valor);
+    T extrairMin();
+    void diminuirChave(Handle h, const T& novoValor);
+
+    // Esvazia o heap mantendo a capacidade. Custo: O(handles já criados)
+    void limpar();
+
+private:
+    struct Item {
+        T chave;
+        Handle id;
+    };
+
+    std::vector<Item> itens;       // o heap implícito: filhos de i em 4i+1 .. 4i+4
+    std::vector<int> posicao;      // posicao[id]: índice do item em `itens`
+    std::vector<Handle> idsLivres; // handles de itens já extraídos
+
+    void subir(size_t i);
+    void descer(size_t i);
+    void colocar(size_t i, const Item& item) {
+        itens[i] = item;
+        posicao[item.id] = static_cast<int>(i);
+    }
+};
+
+template <typename T>
+const T& HeapQuaternario<T>::getMin() const {
+    if (ehVazio()) throw std::runtime_error("Heap vazio");
+    return itens[0].chave;
+}
+
+// Insere no fim e sobe. Custo: O(log4 n)
+template <typename T>
+typename HeapQuaternario<T>::Handle HeapQuaternario<T>::inserir(const T& valor) {
+    Handle id;
+    if (!idsLivres.empty()) {
+        id = idsLivres.back();
+        idsLivres.pop_back();
+    } else {
+        id = static_cast<Handle>(posicao.size());
+        posicao.push_back(-1);
+    }
+    itens.push_back(Item{valor, id});
+    posicao[id] = static_cast<int>(itens.size() - 1);
+    subir(itens.size() - 1);
+    return id;
+}
+
+// Custo: O(4 log4 n)
+template <typename T>
+T HeapQuaternario<T>::extrairMin() {
+    if (ehVazio()) {
+        throw std::runtime_error("Heap está vazio");
+    }
+    T minValor = itens[0].chave;
+    idsLivres.push_back(itens[0].id);
+    posicao[itens[0].id] = -1;
+    Item ultimo = itens.back();
+    itens.pop_back();
+    if (!itens.empty()) {
+        colocar(0, ultimo);
+        descer(0);
+    }
+    return minValor;
+}
+
+// Custo: O(log4 n)
+template <typename T>
+void HeapQuaternario<T>::diminuirChave(Handle h, const T& novoValor) {
+    size_t i = static_cast<size_t>(posicao[h]);
+    if (novoValor > itens[i].chave) {
+        throw std::invalid_argument("Nova chave é maior que a chave atual.");
+    }
+    itens[i].chave = novoValor;
+    subir(i);
+}
+
+template <typename T>
+void HeapQuaternario<T>::limpar() {
+    itens.clear();
+    idsLivres.clear();
+    posicao.clear();
+}
+
+// Sobe o item i enquanto for menor que o pai (o "buraco" desce, sem trocas)
+template <typename T>
+void HeapQuaternario<T>::subir(size_t i) {
+    Item item = itens[i];
+    while (i > 0) {
+        size_t pai = (i - 1) / 4;
+        if (!(item.chave < itens[pai].chave)) break;
+        colocar(i, itens[pai]);
+        i = pai;
+    }
+    colocar(i, item);
+}
+
+// Desce o item i trocando pelo menor dos até 4 filhos
+template <typename T>
+void HeapQuaternario<T>::descer(size_t i) {
+    Item item = itens[i];
+    const size_t n = itens.size();
+    while (true) {
+        size_t primeiro = 4 * i + 1;
+        if (primeiro >= n) break;
+        size_t menor = primeiro;
+        size_t fim = std::min(primeiro + 4, n);
+        for (size_t c = primeiro + 1; c < fim; ++c) {
+            if (itens[c].chave < itens[menor].chave) menor = c;
+        }
+        if (!(itens[menor].chave < item.chave)) break;
+        colocar(i, itens[menor]);
+        i = menor;
+    }
+    colocar(i, item);
+}
+
+#endif
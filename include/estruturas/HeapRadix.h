@@ -0,0 +1,145 @@
+#ifndef HEAP_RADIX_H
+#define HEAP_RADIX_H
+
+#include <vector>
+#include <stdexcept> // Para runtime_error
+#include <type_traits>
+#include <utility>
+
+// Heap radix (radix heap) para chaves inteiras monótonas, com handles estáveis.
+// Mesma interface do FibHeap, para itens T com um membro inteiro `first` >= 0 (a
+// chave; ex.: std::pair<distância, sala>). Monótona: nenhuma chave inserida ou
+// diminuída pode ser menor que a última extraída, como em Dijkstra com pesos
+// positivos. A restrição vale enquanto houver itens: ao esvaziar, o heap recomeça
+// do zero. O balde de um item é o comprimento em bits de (chave XOR último
+// extraído), então cada item só desce de balde: O(bits) amortizado por item.
+// Entre itens de mesma chave a ordem de extração não é especificada.
+template <typename T>
+class HeapRadix {
+public:
+    using Handle = int;
+    static constexpr Handle NULO = -1;
+
+    HeapRadix() : baldes(NUM_BALDES) {}
+
+    bool ehVazio() const { return numItens == 0; }
+    int getTamanho() const { return numItens; }
+
+    Handle inserir(const T& valor);
+    T extrairMin();
+    void diminuirChave(Handle h, const T& novoValor);
+
+    // Esvazia o heap mantendo a capacidade dos baldes. Custo: O(itens + baldes)
+    void limpar();
+
+private:
+    using Chave = std::make_unsigned_t<std::decay_t<decltype(std::declval<T>().first)>>;
+    static constexpr int NUM_BALDES = static_cast<int>(sizeof(Chave) * 8) + 1;
+
+    struct Item {
+        T valor;
+        int balde;  // -1 se já extraído
+        int indice; // posição no balde
+    };
+
+    std::vector<std::vector<Handle>> baldes; // baldes[0]: itens com a chave == ultimo
+    std::vector<Item> itens;
+    std::vector<Handle> idsLivres;
+    Chave ultimo = 0;
+    int numItens = 0;
+
+    static Chave chave(const T& valor) { return static_cast<Chave>(valor.first); }
+
+    int baldeDe(Chave c) const {
+        const unsigned long long x = static_cast<unsigned long long>(c ^ ultimo);
+        return x == 0 ? 0 : 64 - __builtin_clzll(x);
+    }
+    void colocar(Handle h) {
+        const int b = baldeDe(chave(itens[h].valor));
+        itens[h].balde = b;
+        itens[h].indice = static_cast<int>(baldes[b].size());
+        baldes[b].push_back(h);
+    }
+    void retirar(Handle h) {
+        auto& balde = baldes[itens[h].balde];
+        const Handle movido = balde.back();
+        balde[itens[h].indice] = movido;
+        itens[movido].indice = itens[h].indice;
+        balde.pop_back();
+    }
+};
+
+template <typename T>
+typename HeapRadix<T>::Handle HeapRadix<T>::inserir(const T& valor) {
+    if (chave(valor) < ultimo) {
+        throw std::invalid_argument("Chave menor que a última extraída (heap radix exige chaves monótonas).");
+    }
+    Handle h;
+    if (!idsLivres.empty()) {
+        h = idsLivres.back();
+        idsLivres.pop_back();
+        itens[h].valor = valor;
+    } else {
+        h = static_cast<Handle>(itens.size());
+        itens.push_back(Item{valor, -1, -1});
+    }
+    colocar(h);
+    numItens++;
+    return h;
+}
+
+// Custo Amortizado: O(bits da chave)
+template <typename T>
+T HeapRadix<T>::extrairMin() {
+    if (ehVazio()) {
+        throw std::runtime_error("Heap está vazio");
+    }
+    if (baldes[0].empty()) {
+        // Primeiro balde não vazio: o seu mínimo vira `ultimo` e os itens se redistribuem
+        // em baldes menores
+        int b = 1;
+        while (baldes[b].empty()) b++;
+        Chave menor = chave(itens[baldes[b][0]].valor);
+        for (Handle h : baldes[b]) {
+            if (chave(itens[h].valor) < menor) menor = chave(itens[h].valor);
+        }
+        ultimo = menor;
+        std::vector<Handle> mover;
+        mover.swap(baldes[b]);
+        for (Handle h : mover) colocar(h);
+        mover.clear();
+        mover.swap(baldes[b]); // devolve a capacidade ao balde (agora vazio)
+    }
+    const Handle h = baldes[0].back();
+    baldes[0].pop_back();
+    itens[h].balde = -1;
+    idsLivres.push_back(h);
+    // Vazio, o heap volta a aceitar qualquer chave (ex.: o Dijkstra da próxima origem)
+    if (--numItens == 0) ultimo = 0;
+    return itens[h].valor;
+}
+
+// Custo: O(1)
+template <typename T>
+void HeapRadix<T>::diminuirChave(Handle h, const T& novoValor) {
+    if (novoValor > itens[h].valor) {
+        throw std::invalid_argument("Nova chave é maior que a chave atual.");
+    }
+    if (chave(novoValor) < ultimo) {
+        throw std::invalid_argument("Chave menor que a última extraída (heap radix exige chaves monótonas).");
+    }
+    retirar(h);
+    itens[h].valor = novoValor;
+    colocar(h);
+}
+
+template <typename T>
+void HeapRadix<T>::limpar() {
+    for (auto& balde : baldes) balde.clear();
+    itens.clear();
+    idsLivres.clear();
+    ultimo = 0;
+    numItens = 0;
+}
+
+#endif
@@ -0,0 +1,90 @@
+/**
+ * @file MapaDeBits.h
+ * @brief Definição da classe MapaDeBits, um conjunto de inteiros compactado em bits.
+ * @details Este arquivo contém um conjunto de índices [0, n) guardado em palavras
+ * de 64 bits, usado pelo Prisioneiro para marcar as salas já visitadas.
+ */
+
+#ifndef MAPA_DE_BITS_H
+#define MAPA_DE_BITS_H
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+/**
+ * @class MapaDeBits
+ * @brief Conjunto de índices em [0, n) com um bit por índice.
+ * @details As palavras são de 64 bits, então o conjunto ocupa n/8 bytes
+ * (arredondado para cima até a palavra). Índices fora de [0, n) nunca estão
+ * marcados e são ignorados por `marcar`.
+ */
+class MapaDeBits {
+private:
+    /// @brief Palavras de 64 bits; o bit `i % 64` da palavra `i / 64` representa o índice `i`.
+    std::vector<uint64_t> palavras;
+    /// @brief Quantidade de índices representados.
+    int numBits;
+
+public:
+    /**
+     * @brief Construtor que cria um conjunto vazio de `n` índices.
+     * @param n A quantidade de índices representáveis.
+     */
+    explicit MapaDeBits(int n = 0) : numBits(0) {
+        redimensionar(n);
+    }
+
+    /**
+     * @brief Redimensiona o conjunto para `n` índices, desmarcando todos.
+     * @param n A nova quantidade de índices.
+     */
+    void redimensionar(int n) {
+        numBits = std::max(0, n);
+        palavras.assign((numBits + 63) / 64, 0);
+    }
+
+    /**
+     * @brief Desmarca todos os índices sem realocar (custo de n/64 palavras).
+     */
+    void limpar() {
+        std::fill(palavras.begin(), palavras.end(), 0);
+    }
+
+    /**
+     * @brief Marca um índice.
+     * @param i O índice; valores fora de [0, n) são ignorados.
+     */
+    void marcar(int i) {
+        if (i >= 0 && i < numBits) {
+            palavras[i >> 6] |= uint64_t(1) << (i & 63);
+        }
+    }
+
+    /**
+     * @brief Verifica se um índice está marcado.
+     * @param i O índice a consultar.
+     * @return `true` se o índice estiver marcado; `false` se não estiver ou for inválido.
+     */
+    bool contem(int i) const {
+        return i >= 0 && i < numBits && ((palavras[i >> 6] >> (i & 63)) & 1);
+    }
+
+    /**
+     * @brief Obtém a quantidade de índices representados.
+     * @return O valor de `n`.
+     */
+    int tamanho() const {
+        return numBits;
+    }
+
+    /**
+     * @brief Acesso às palavras, para leituras vetorizadas (ex.: coleta AVX2 de bits).
+     * @return Ponteiro para a primeira das (n + 63) / 64 palavras.
+     */
+    const uint64_t* dados() const {
+        return palavras.data();
+    }
+};
+
+#endif
@@ -1,6 +1,6 @@
 /**
  * @file MinhaListaAdj.h
- * @brief Definição de uma classe de lista duplamente encadeada genérica.
+ * @brief Definição de um vetor pequeno genérico com capacidade interna.
  * @details Este arquivo contém a implementação de uma lista customizada, usada
  * para criar as listas de adjacência na representação do grafo.
  */
@@ -8,48 +8,71 @@
 #ifndef MINHA_LISTA_H
 #define MINHA_LISTA_H
 
+#include <cstddef>
+#include <new>
+#include <utility>
+
 /**
  * @class listaAdj
- * @brief Implementação de uma lista duplamente encadeada genérica.
- * @details Esta classe gerencia uma coleção de nós ligados por ponteiros `prox` (próximo)
- * e `ant` (anterior), permitindo a inserção eficiente no final da lista.
+ * @brief Vetor pequeno (small vector) genérico com os primeiros elementos guardados no próprio objeto.
+ * @details Até `CAPACIDADE_INTERNA` elementos ficam num buffer interno; acima disso os
+ * elementos passam para um bloco contíguo no heap, que dobra de tamanho quando enche.
+ * Como as salas dos labirintos têm grau 2 a 4, a maioria das listas não aloca nada e a
+ * varredura dos vizinhos lê memória contígua. A ordem de inserção é preservada, também
+ * na remoção. Ponteiros e iteradores são invalidados por inserções e remoções.
+ * Ex: `for (const auto& vizinho : lista) { ... }`
  * @tparam T O tipo de dado a ser armazenado na lista.
+ * @tparam CAPACIDADE_INTERNA Quantos elementos cabem sem alocação (padrão: 4).
  */
-template <typename T>
+template <typename T, int CAPACIDADE_INTERNA = 4>
 class listaAdj {
 public:
-    /**
-     * @struct No
-     * @brief Representa um nó individual dentro da lista duplamente encadeada.
-     */
-    struct No{
-        T dado;
-        No* prox;
-        No* ant;
-        /** 
-         * @brief Construtor do nó.
-         * @param d O dado a ser armazenado.
-         * @param p Ponteiro para o próximo nó (padrão: nullptr).
-         * @param a Ponteiro para o nó anterior (padrão: nullptr).
-         */
-        No(T d, No* p = nullptr, No* a = nullptr) : dado(d), prox(p), ant(a) {}
-    };
+    using iterator = T*;
+    using const_iterator = const T*;
 
 private:
-    No* cabeca;
-    No* cauda;
+    T* dados;       // aponta para `interno` ou para o bloco no heap
     int tamanho;
+    int capacidade;
+    alignas(T) unsigned char interno[sizeof(T) * CAPACIDADE_INTERNA];
+
+    T* bufferInterno() { return reinterpret_cast<T*>(interno); }
+    bool usaInterno() const { return dados == reinterpret_cast<const T*>(interno); }
+
+    /// Destrói os elementos e libera o bloco do heap, se houver.
+    void liberar() {
+        for (int i = 0; i < tamanho; ++i) dados[i].~T();
+        if (!usaInterno()) ::operator delete(dados);
+    }
+
+    /// Toma os elementos de `outra`, que fica vazia (e de volta ao buffer interno).
+    void tomar(listaAdj& outra) {
+        if (outra.usaInterno()) {
+            dados = bufferInterno();
+            capacidade = CAPACIDADE_INTERNA;
+            for (int i = 0; i < outra.tamanho; ++i) {
+                new (dados + i) T(std::move(outra.dados[i]));
+                outra.dados[i].~T();
+            }
+        } else {
+            dados = outra.dados;
+            capacidade = outra.capacidade;
+            outra.dados = outra.bufferInterno();
+            outra.capacidade = CAPACIDADE_INTERNA;
+        }
+        tamanho = outra.tamanho;
+        outra.tamanho = 0;
+    }
 
 public:
     /**
-     * @brief Construtor que cria uma lista vazia.
+     * @brief Construtor que cria uma lista vazia (sem alocação).
      */
-    listaAdj() : cabeca(nullptr), cauda(nullptr), tamanho(0) {}
+    listaAdj() : dados(bufferInterno()), tamanho(0), capacidade(CAPACIDADE_INTERNA) {}
 
     /**
      * @brief Construtor de cópia (deletado).
-     * @details A cópia é proibida para evitar problemas de gerenciamento de memória,
-     * como a liberação dupla (double free) dos ponteiros.
+     * @details As listas de adjacência pertencem ao grafo e nunca são copiadas.
      */
     listaAdj(const listaAdj&) = delete;
 
@@ -58,36 +81,73 @@ public:
      * @details Proibido pelos mesmos motivos do construtor de cópia.
      */
     listaAdj& operator=(const listaAdj&) = delete;
-    
+
+    /**
+     * @brief Construtor de movimento: toma o bloco do heap, ou move os elementos internos.
+     * @param outra A lista de origem, que fica vazia.
+     */
+    listaAdj(listaAdj&& outra) noexcept : dados(bufferInterno()), tamanho(0), capacidade(CAPACIDADE_INTERNA) {
+        tomar(outra);
+    }
+
+    /**
+     * @brief Atribuição por movimento.
+     * @param outra A lista de origem, que fica vazia.
+     * @return Esta lista.
+     */
+    listaAdj& operator=(listaAdj&& outra) noexcept {
+        if (this != &outra) {
+            liberar();
+            tomar(outra);
+        }
+        return *this;
+    }
+
     /**
-     * @brief Destrutor que libera a memória de todos os nós da lista.
+     * @brief Destrutor que libera a memória dos elementos da lista.
      */
     ~listaAdj() {
-        No* atual = cabeca;
-        while (atual) {
-            No* proximo = atual->prox;
-            delete atual;
-            atual = proximo;
+        liberar();
+    }
+
+    /**
+     * @brief Garante espaço para `n` elementos sem novas alocações.
+     * @param n A capacidade desejada.
+     */
+    void reserve(int n) {
+        if (n <= capacidade) return;
+        T* novo = static_cast<T*>(::operator new(sizeof(T) * static_cast<size_t>(n)));
+        for (int i = 0; i < tamanho; ++i) {
+            new (novo + i) T(std::move(dados[i]));
+            dados[i].~T();
         }
+        if (!usaInterno()) ::operator delete(dados);
+        dados = novo;
+        capacidade = n;
     }
 
     /**
      * @brief Insere um novo elemento no final da lista.
-     * @details Esta operação tem complexidade de tempo constante, O(1), graças
-     * ao ponteiro `cauda`.
+     * @details Complexidade O(1) amortizada; só aloca ao ultrapassar a capacidade interna.
      * @param dado O valor a ser inserido.
      */
     void inserir_no_fim(T dado) {
-        No* novo_no = new No(dado, nullptr, cauda);
-        if (!cabeca) {
-            cabeca = cauda = novo_no;
-        } else {
-            cauda->prox = novo_no;
-            cauda = novo_no;
-        }
+        if (tamanho == capacidade) reserve(capacidade * 2);
+        new (dados + tamanho) T(std::move(dado));
         tamanho++;
     }
 
+    /**
+     * @brief Remove o elemento de uma posição, preservando a ordem dos demais.
+     * @details Operação O(tamanho), desprezível para o grau das salas.
+     * @param indice A posição do elemento (0 <= indice < size()).
+     */
+    void remover(int indice) {
+        for (int i = indice; i + 1 < tamanho; ++i) dados[i] = std::move(dados[i + 1]);
+        tamanho--;
+        dados[tamanho].~T();
+    }
+
     /**
      * @brief Retorna o número de elementos na lista.
      * @return O tamanho atual da lista.
@@ -97,14 +157,32 @@ public:
     }
 
     /**
-     * @brief Obtém um ponteiro para o primeiro nó da lista.
-     * @details Útil para iniciar a iteração manual sobre os elementos da lista.
-     * Ex: `for (auto no = lista.get_cabeca(); no != nullptr; no = no->prox) { ... }`
-     * @return Um ponteiro para o nó `cabeca`.
+     * @brief Indica se a lista está vazia.
      */
-    No* get_cabeca() const {
-        return cabeca;
+    bool vazia() const {
+        return tamanho == 0;
     }
+
+    /**
+     * @brief Bytes alocados no heap (0 enquanto os elementos cabem no buffer interno).
+     */
+    size_t bytesNoHeap() const {
+        return usaInterno() ? 0 : sizeof(T) * static_cast<size_t>(capacidade);
+    }
+
+    /**
+     * @brief Acesso ao elemento de uma posição (sem verificação de limites).
+     */
+    T& operator[](int indice) { return dados[indice]; }
+    const T& operator[](int indice) const { return dados[indice]; }
+
+    /**
+     * @brief Iteradores para o laço `for` por intervalo (ponteiros para memória contígua).
+     */
+    iterator begin() { return dados; }
+    iterator end() { return dados + tamanho; }
+    const_iterator begin() const { return dados; }
+    const_iterator end() const { return dados + tamanho; }
 };
 
-#endif
\ No newline at end of file
+#endif
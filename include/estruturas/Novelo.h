@@ -2,14 +2,13 @@
  * @file Novelo.h
  * @author Thiago Nerton
  * @brief Definição da classe genérica Novelo, uma estrutura de dados de pilha (LIFO).
- * @details Este arquivo contém a implementação de uma pilha usando uma lista encadeada,
+ * @details Este arquivo contém a implementação de uma pilha sobre um vetor contíguo,
  * utilizada pelo Prisioneiro para armazenar seu caminho de volta (backtracking).
  */
 
 #ifndef NOVELO_H
 #define NOVELO_H
 
-#include "LinhaNovelo.h"
 #include <vector>
 #include <stdexcept>
 
@@ -19,29 +18,32 @@
  * @details Esta classe funciona como uma pilha (Last-In, First-Out), onde o último
  * "rastro" deixado é o primeiro a ser recuperado. É a base para a memória de
  * backtracking do Prisioneiro.
+ *
+ * Os rastros ficam em um vetor contíguo: empilhar e desempilhar não alocam nem
+ * liberam memória (exceto quando a capacidade cresce), esvaziar é O(1) para tipos
+ * triviais e copiar o novelo (um retrato do backtracking) é uma cópia de vetor.
  * @tparam T O tipo de dado a ser armazenado na pilha.
  */
 template <typename T>
 class Novelo {
 private:
-    /// @brief Ponteiro para o topo da pilha (o último rastro adicionado).
-    LinhaNovelo<T>* ultRastro;
-    /// @brief Contador do número de elementos na pilha.
-    int salasComRastro;
+    /// @brief Os rastros, do mais antigo (índice 0) ao topo (último).
+    std::vector<T> rastros;
 
 public:
     /**
      * @brief Construtor que cria um Novelo (pilha) vazio.
      */
-    Novelo() : ultRastro(nullptr), salasComRastro(0) {}
+    Novelo() = default;
 
     /**
-     * @brief Destrutor que libera toda a memória alocada pelos nós da pilha.
+     * @brief Reserva espaço para `capacidade` rastros.
+     * @details O prisioneiro reserva o número de salas do labirinto, o limite da
+     * profundidade da busca, e assim nunca realoca durante a simulação.
+     * @param capacidade A quantidade de rastros a reservar.
      */
-    ~Novelo() {
-        while (!nenhumRastro()) {
-            puxarRastro();
-        }
+    void reservar(int capacidade) {
+        if (capacidade > 0) rastros.reserve(static_cast<size_t>(capacidade));
     }
 
     /**
@@ -49,10 +51,7 @@ public:
      * @param valor O valor a ser adicionado.
      */
     void criarRastro(const T& valor) {
-        LinhaNovelo<T>* novoNo = new LinhaNovelo<T>(valor);
-        novoNo->prx = ultRastro;
-        ultRastro = novoNo;
-        salasComRastro++;
+        rastros.push_back(valor);
     }
 
     /**
@@ -63,10 +62,14 @@ public:
         if (nenhumRastro()) {
             throw std::runtime_error("Erro: Não tem rastros. Impossível puxar rastro.");
         }
-        LinhaNovelo<T>* tmp = ultRastro;
-        ultRastro = ultRastro->prx;
-        delete tmp;
-        salasComRastro--;
+        rastros.pop_back();
+    }
+
+    /**
+     * @brief Remove todos os rastros, mantendo a capacidade reservada.
+     */
+    void limpar() {
+        rastros.clear();
     }
 
     /**
@@ -78,7 +81,7 @@ public:
         if (nenhumRastro()) {
             throw std::runtime_error("Erro: Não tem rastros.");
         }
-        return ultRastro->sala;
+        return rastros.back();
     }
     
     /**
@@ -90,7 +93,7 @@ public:
         if (nenhumRastro()) {
             throw std::runtime_error("Erro: Não tem rastros.");
         }
-        return ultRastro->sala;
+        return rastros.back();
     }
 
     /**
@@ -98,7 +101,7 @@ public:
      * @return `true` se a pilha estiver vazia, `false` caso contrário.
      */
     bool nenhumRastro() const {
-        return ultRastro == nullptr;
+        return rastros.empty();
     }
 
     /**
@@ -106,8 +109,15 @@ public:
      * @return A quantidade de elementos atualmente na pilha.
      */
     int getSalasComRastro() const {
-        return salasComRastro;
+        return static_cast<int>(rastros.size());
+    }
+
+    /**
+     * @brief Bytes reservados para os rastros (capacidade do vetor).
+     */
+    size_t bytesAlocados() const {
+        return rastros.capacity() * sizeof(T);
     }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -13,11 +13,30 @@
 #include <unordered_map>
 #include "estruturas/MinhaListaAdj.h"
 #include "estruturas/MeuPair.h"
+#include "estruturas/FibHeap.h"
+#include "utils/Estatisticas.h"
 #include <utility> // Para std::pair
 #include <fstream> // Para std::ifstream
+#include <limits>
+#include <cstdint>
+#include <cassert>
 
 class Grafo {
 public:
+    // Distância usada para salas inalcançáveis
+    static constexpr int INFINITO = std::numeric_limits<int>::max();
+    // Entradas extras no fim do CSR: leituras SIMD de até PREENCHIMENTO_SIMD vizinhos a
+    // partir de qualquer sala não saem do vetor (id -1, peso INFINITO)
+    static constexpr int PREENCHIMENTO_SIMD = 8;
+
+    // Vizinhança de uma sala no CSR em estrutura de arrays: ids e pesos em vetores
+    // separados, para varreduras que leem um campo de cada vez
+    struct Vizinhanca {
+        const int* ids;
+        const int* pesos;
+        int grau;
+    };
+
     int getNumVertices() const { return nV; }
     void setNumVertices(int n) { nV = n; }
     void setNumArestas(int n) { nA = n; }
@@ -28,6 +47,12 @@ public:
 
     // Método para adicionar uma aresta ao grafo
     void adicionar_aresta(int u, int v, int peso);
+    // Altera o peso do corredor u-v (cria se não existir; peso <= 0 remove).
+    // Retorna o peso anterior (-1 se não existia). A forma compacta, se existir, é
+    // atualizada só nas salas u e v.
+    int definirPeso(int u, int v, int peso);
+    // Remove todas as arestas (mantém nV e a saída)
+    void limpar();
     void set_saida(int vSaida);
     int get_saida() const;
     int getPesoAresta(int u, int v) const;
@@ -35,9 +60,99 @@ public:
     const listaAdj<MeuPair<int, int>>& get_vizinhos(int vertice) const;
     std::vector<int> minCaminhosCalc(int origem, int destino) const;
 
+    // Constrói a vizinhança compacta (CSR): graus e vizinhos em memória contígua.
+    // Deve ser chamado após a última aresta; invalidado por adicionar_aresta.
+    void compactar();
+    bool estaCompacto() const { return compacto; }
+    // Grau da sala: O(1) pelo CSR; sem a forma compacta, pelo tamanho da lista
+    int grau(int vertice) const {
+        if (vertice < 0 || vertice >= nV) return 0;
+        if (!compacto) return get_vizinhos(vertice).size();
+        return grauCsr[vertice];
+    }
+    // Vizinhos da sala (ids e pesos), na ordem de inserção; vazia fora de [0, nV) (requer compactar)
+    Vizinhanca vizinhanca(int vertice) const {
+        assert(compacto && "vizinhanca requer compactar()");
+        if (vertice < 0 || vertice >= nV) return Vizinhanca{idsCsr.data(), pesosCsr.data(), 0};
+        const int inicio = inicioVizinhos[vertice];
+        return Vizinhanca{idsCsr.data() + inicio, pesosCsr.data() + inicio, grauCsr[vertice]};
+    }
+    // Tabelas de alias (Vose) por sala para o passeio ponderado: P(vizinho) ∝ 1/peso
+    // (requer compactar)
+    const double* probAlias(int vertice) const {
+        assert(compacto && "probAlias requer compactar()");
+        return aliasProb.data() + inicioVizinhos[vertice];
+    }
+    const int* indiceAlias(int vertice) const {
+        assert(compacto && "indiceAlias requer compactar()");
+        return aliasIdx.data() + inicioVizinhos[vertice];
+    }
+
+    // Distâncias mínimas (Dijkstra) de 'origem' para todas as salas; INFINITO se inalcançável.
+    // Fila: fila de prioridade de std::pair<int, int> (distância, sala) com a interface
+    // de FibHeap (inserir -> handle, diminuirChave, extrairMin, ehVazio, NULO); ver
+    // HeapQuaternario, HeapPareamento e HeapRadix.
+    template <typename Fila = FibHeap<std::pair<int, int>>>
+    std::vector<int> distanciasDe(int origem) const;
+    // Rotula cada sala com o id do seu componente conexo; retorna o número de componentes
+    int componentes(std::vector<int>& rotulo) const;
+    // Bytes no heap: listas de adjacência (nós do mapa e blocos além da capacidade
+    // interna), CSR e tabelas de alias
+    int64_t bytesAlocados() const;
+
 private:
     std::unordered_map<int, listaAdj<MeuPair<int, int>>> adjacencias;
     int vSaida;
     int nV;
     int nA;
+
+    // Vizinhança compacta (CSR) e tabelas de alias, alinhadas por índice de aresta. Cada
+    // sala ocupa um trecho [inicio, inicio + capacidade) com os grau primeiros em uso;
+    // uma sala que cresce além da capacidade muda para o fim dos vetores (trecho dobrado)
+    bool compacto = false;
+    std::vector<int> inicioVizinhos;             // início do trecho de cada sala
+    std::vector<int> grauCsr;                    // entradas em uso no trecho
+    std::vector<int> capacidadeCsr;              // tamanho do trecho
+    int entradasCsr = 0;                         // fim do último trecho (antes do preenchimento)
+    std::vector<int> idsCsr;                     // vizinho de cada entrada (+ preenchimento)
+    std::vector<int> pesosCsr;                   // peso de cada entrada (+ preenchimento)
+    std::vector<double> aliasProb;               // probabilidade de ficar na coluna
+    std::vector<int> aliasIdx;                   // coluna alternativa (índice local)
+
+    void construirAlias(int vertice);
+    void recompactarSala(int sala);
 };
+
+// Cada sala entra uma vez na fila; melhorias usam diminuirChave pelo handle. Com a
+// forma compacta a vizinhança é lida do CSR (mesma ordem das listas).
+template <typename Fila>
+std::vector<int> Grafo::distanciasDe(int origem) const {
+    std::vector<int> dist(nV, INFINITO);
+    if (origem < 0 || origem >= nV) return dist;
+
+    using Item = std::pair<int, int>; // (distância, sala)
+    Fila fila;
+    std::vector<typename Fila::Handle> naFila(nV, Fila::NULO); // handle de cada sala ainda na fila
+    auto relaxar = [&](int v, int nd) {
+        if (v < 0 || v >= nV || nd >= dist[v]) return;
+        dist[v] = nd;
+        if (naFila[v] != Fila::NULO) fila.diminuirChave(naFila[v], Item{nd, v});
+        else naFila[v] = fila.inserir(Item{nd, v});
+        LAB_CONTAR(operacoesHeap);
+    };
+    dist[origem] = 0;
+    naFila[origem] = fila.inserir(Item{0, origem});
+    LAB_CONTAR(operacoesHeap);
+    while (!fila.ehVazio()) {
+        auto [d, u] = fila.extrairMin();
+        LAB_CONTAR(operacoesHeap);
+        naFila[u] = Fila::NULO;
+        if (compacto) {
+            const Vizinhanca vizinhos = vizinhanca(u);
+            for (int k = 0; k < vizinhos.grau; ++k) relaxar(vizinhos.ids[k], d + vizinhos.pesos[k]);
+        } else {
+            for (const auto& vizinho : get_vizinhos(u)) relaxar(vizinho.primeiro, d + vizinho.segundo);
+        }
+    }
+    return dist;
+}
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "Grafo.h"
+#include <cstdint>
 
 /**
  * @class Minotauro
@@ -21,6 +22,14 @@
  */
 class Minotauro {
 public:
+    /// @brief Fila de prioridade do Dijkstra do reparo (corredor alongado ou desabado).
+    enum class FilaReparo {
+        FIB_HEAP,    ///< Heap de Fibonacci (padrão)
+        QUATERNARIO, ///< Heap 4-ário implícito
+        PAREAMENTO,  ///< Heap de pareamento
+        RADIX        ///< Heap radix (chaves monótonas)
+    };
+
     /**
      * @brief Construtor da classe Minotauro.
      * @param posInicial O vértice (sala) inicial onde o Minotauro é criado.
@@ -40,13 +49,34 @@ public:
      */
     void lembrarCaminhos();
 
+    /**
+     * @brief Atualiza a memória após a mudança de um corredor, sem refazer o Floyd-Warshall.
+     * @details Reparo incremental no estilo Ramalingam-Reps: só as linhas (origens)
+     * cujos caminhos mínimos podem mudar são tocadas e, nelas, só as salas afetadas.
+     * O grafo já deve refletir o novo peso quando este método é chamado.
+     * @param u Um extremo do corredor.
+     * @param v O outro extremo do corredor.
+     * @param pesoAntigo O peso anterior (<= 0 se o corredor não existia).
+     * @param pesoNovo O novo peso (<= 0 se o corredor desabou).
+     * @return O número de linhas da memória que foram reparadas.
+     */
+    int atualizarCorredor(int u, int v, int pesoAntigo, int pesoNovo);
+
+    /**
+     * @brief Escolhe a fila de prioridade usada pelo reparo de `atualizarCorredor`.
+     * @details Todas dão as mesmas distâncias; os próximos passos podem diferir entre
+     * caminhos mínimos empatados.
+     * @param fila A fila do Dijkstra restrito às salas afetadas.
+     */
+    void setFilaReparo(FilaReparo fila) { filaReparo = fila; }
+
     /**
      * @brief Consulta a memória para encontrar o próximo passo em um caminho mínimo.
      * @param atual O vértice de origem.
      * @param dest O vértice de destino.
      * @return O primeiro vértice no caminho mais curto de 'atual' para 'dest'. Retorna -1 se o caminho for desconhecido.
      */
-    int lembrarProxPasso(int atual, int dest);
+    int lembrarProxPasso(int atual, int dest) const;
 
     /**
      * @brief Consulta a memória para encontrar a distância de um caminho mínimo.
@@ -54,7 +84,20 @@ public:
      * @param dest O vértice de destino.
      * @return A distância total (soma dos pesos) do caminho mais curto entre 'atual' e 'dest'.
      */
-    int lembrarDist(int atual, int dest);
+    int lembrarDist(int atual, int dest) const;
+
+    /**
+     * @brief Linha da memória de distâncias a partir de `origem` (uma entrada por sala).
+     * @details Para consultas em massa, sem a checagem e o log de `lembrarDist`; requer
+     * a memória calculada e `origem` válida.
+     */
+    const std::vector<int>& lembrarDistancias(int origem) const { return memoriaDistancias[origem]; }
+
+    /**
+     * @brief Linha da memória de próximos passos a partir de `origem` (-1: sem caminho).
+     * @details Para consultas em massa, como `lembrarDistancias`.
+     */
+    const std::vector<int>& lembrarProxPassos(int origem) const { return memoriaCaminho[origem]; }
 
     /**
      * @brief Atualiza a posição atual do Minotauro.
@@ -74,6 +117,18 @@ public:
      */
     int getPos() const;
 
+    /**
+     * @brief Bytes ocupados pelas matrizes de memória (capacidade das linhas).
+     */
+    int64_t bytesAlocados() const;
+
+    /**
+     * @brief Estima os bytes das matrizes de memória para um labirinto de `nV` salas.
+     * @details Duas matrizes `nV` x `nV` de `int`, com o cabeçalho de cada linha. Permite
+     * recusar um Floyd-Warshall que não cabe antes de alocá-lo.
+     */
+    static int64_t estimarBytes(int nV);
+
     /**
      * @brief Obtém o tempo global da simulação.
      * @return O tempo global atual.
@@ -88,6 +143,14 @@ public:
     void setTempoMinotauro(int tempo) { tempoMinotauro = tempo; }
 
 private:
+    /// @brief Corredor encurtado ou aberto: relaxa as linhas que passam a usá-lo.
+    int relaxarCorredor(int u, int v, int peso);
+
+    /// @brief Corredor alongado ou removido: refaz as salas cujos caminhos o usavam.
+    /// @tparam Fila Fila de prioridade de std::pair<long long, int> com a interface de FibHeap.
+    template <typename Fila>
+    int repararCorredor(int u, int v, int pesoAntigo);
+
     /// @brief O vértice (sala) atual onde o Minotauro está.
     int pos;
 
@@ -108,4 +171,7 @@ private:
 
     /// @brief Tempo global da simulação.
     int tempoMinotauro;
+
+    /// @brief Fila de prioridade do reparo incremental da memória.
+    FilaReparo filaReparo = FilaReparo::FIB_HEAP;
 };
\ No newline at end of file
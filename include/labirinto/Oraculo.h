@@ -0,0 +1,106 @@
+/**
+ * @file Oraculo.h
+ * @author Thiago Nerton
+ * @brief Definição da classe Oraculo, que responde consultas de distância sobre um cenário (flag `--query`).
+ * @details Consultas, uma por linha (linhas vazias e iniciadas por `#` são ignoradas):
+ * - `dist A B`: distância mínima de A a B;
+ * - `passo A B`: próxima sala de um caminho mínimo de A para B (A, se A == B): o
+ *   primeiro vizinho de A, na ordem do arquivo, com as duas estratégias;
+ * - `raio R [C]`: salas a distância até R de C (padrão: o covil do Minotauro).
+ *
+ * As salas são números ou os nomes `entrada`, `saida` e `covil` (posição inicial do
+ * Minotauro). As respostas seguem o labirinto do arquivo, sem mudanças de corredor.
+ */
+
+#pragma once
+
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "Simulador.h"
+
+/**
+ * @class Oraculo
+ * @brief Responde lotes de consultas pela memória do Minotauro ou por Dijkstra sob demanda.
+ * @details Cada consulta depende das distâncias a partir de uma sala de origem: a
+ * própria origem em `dist` e `raio`, o destino em `passo` (o grafo é não-direcionado).
+ * O Floyd-Warshall custa O(V³) uma única vez; Dijkstra custa O((V + E) log V) por
+ * origem distinta do lote. A estratégia automática compara os dois custos.
+ */
+class Oraculo {
+public:
+    /// @brief De onde vêm as distâncias.
+    enum class Estrategia {
+        AUTOMATICA, // a mais barata para o lote
+        MEMORIA,    // distâncias do Floyd-Warshall do Minotauro
+        DIJKSTRA    // uma árvore de caminhos mínimos por origem distinta, em paralelo
+    };
+
+    /// @brief Tipo de consulta.
+    enum class Tipo { DISTANCIA, PROXIMO_PASSO, RAIO };
+
+    /**
+     * @struct Consulta
+     * @brief Uma linha de consulta interpretada.
+     */
+    struct Consulta {
+        Tipo tipo = Tipo::DISTANCIA;
+        int a = 0;          // origem (dist, passo) ou centro (raio)
+        int b = 0;          // destino (dist, passo) ou raio
+        int linha = 0;      // linha no arquivo de consultas
+        std::string erro;   // não vazio: linha inválida, respondida com o erro
+    };
+
+    /**
+     * @brief Cria o oráculo sobre um cenário carregado.
+     * @param base O simulador com o cenário; deve sobreviver ao oráculo.
+     */
+    explicit Oraculo(const Simulador& base);
+
+    /**
+     * @brief Lê todas as consultas de um fluxo.
+     * @details Linhas inválidas viram consultas com `erro` preenchido, na sua posição.
+     */
+    std::vector<Consulta> lerConsultas(std::istream& entrada) const;
+
+    /**
+     * @brief Escolhe a estratégia mais barata para um lote.
+     * @param consultas O lote.
+     * @param numThreads Threads disponíveis para as árvores de Dijkstra.
+     * @param limiteMemoriaMiB Limite para as matrizes do Floyd-Warshall (0: sem limite).
+     */
+    Estrategia escolher(const std::vector<Consulta>& consultas, int numThreads, long limiteMemoriaMiB) const;
+
+    /**
+     * @brief Responde o lote, uma linha JSON por consulta, na ordem das consultas.
+     * @param saida O fluxo de destino.
+     * @param consultas O lote.
+     * @param estrategia `MEMORIA` ou `DIJKSTRA` (`AUTOMATICA` é resolvida por `escolher`).
+     * @param numThreads Threads do pool (<= 0: uma por núcleo).
+     * @return O número de consultas inválidas.
+     */
+    int responder(std::ostream& saida, const std::vector<Consulta>& consultas, Estrategia estrategia, int numThreads) const;
+
+private:
+    /// @brief Resultado de uma consulta: distância ou sala, ou as salas do raio.
+    struct Resposta {
+        int valor = -1;          // -1: inalcançável
+        std::vector<int> salas;  // raio, em ordem crescente
+    };
+
+    /**
+     * @brief Sala de origem das distâncias de cada consulta (-1 nas inválidas).
+     * @details `passo` usa o destino e `raio` o centro; `dist` usa um extremo que já
+     * seja origem de outra consulta, se houver, para que as consultas dividam árvores.
+     */
+    std::vector<int> atribuirOrigens(const std::vector<Consulta>& consultas) const;
+
+    /// @brief Responde uma consulta a partir das distâncias de `origem` a todas as salas.
+    Resposta responderComDistancias(const Consulta& consulta, int origem, const std::vector<int>& dist) const;
+
+    /// @brief Converte um número ou nome de sala; `false` se não for uma sala do labirinto.
+    bool lerSala(const std::string& texto, int& sala) const;
+
+    const Simulador& base;
+};
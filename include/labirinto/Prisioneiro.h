@@ -9,13 +9,49 @@
 
 #pragma once
 
+#include <cstdint>
 #include <vector>
-#include "estruturas/MinhaListaAdj.h"
+#include <random>
+#include "estruturas/CaminhoCompacto.h"
 #include "estruturas/MeuPair.h"
 #include "estruturas/Novelo.h"
+#include "estruturas/MapaDeBits.h"
+#include "labirinto/Grafo.h"
 
-// Declaração antecipada da classe Grafo para evitar inclusão circular
-class Grafo;
+/**
+ * @enum PoliticaExploracao
+ * @brief Como o prisioneiro escolhe o próximo corredor a explorar.
+ * @details Todas as políticas só consideram salas não visitadas e, sem opção,
+ * fazem backtracking pelo novelo. A política é resolvida uma vez por movimento em
+ * um `switch` que chama a instância do template correspondente (sem chamada virtual).
+ */
+enum class PoliticaExploracao {
+    DFS,                  // primeiro vizinho (na ordem do arquivo) que os kits pagam
+    ARESTA_MAIS_BARATA,   // vizinho de menor peso (empate: o primeiro)
+    ALEATORIA,            // vizinho sorteado com o gerador próprio do prisioneiro
+    CONSCIENTE_DA_COMIDA  // como DFS, mas só avança se ainda puder desenrolar o novelo inteiro
+};
+
+/**
+ * @enum NivelRegistro
+ * @brief Quanto da jornada do prisioneiro é gravado durante a simulação.
+ * @details Em lotes grandes o registro por movimento pesa mais do que a própria
+ * lógica da simulação; sem relatório humano, basta o resumo.
+ */
+enum class NivelRegistro : uint8_t {
+    DESLIGADO, // nada além do estado atual (posição, kits, contadores)
+    RESUMO,    // acontecimentos significativos (histórico), sem o rastro de salas
+    COMPLETO   // histórico e rastro de salas (e, no Simulador, a linha do tempo)
+};
+
+/**
+ * @enum TipoAcontecimento
+ * @brief Categoria de um acontecimento do histórico do prisioneiro.
+ */
+enum class TipoAcontecimento : uint8_t {
+    BACKTRACK, // voltou para a sala anterior pelo novelo
+    PRESO      // não pôde avançar nem voltar
+};
 
 /**
  * @class Prisioneiro
@@ -31,36 +67,67 @@ public:
      * @brief Registra um evento significativo na jornada do prisioneiro.
      */
     struct HistoricoPrisioneiro {
-        std::string tipo;
-        std::string descricao;
+        TipoAcontecimento tipo;
         int posicao;
         int tempo;
     };
 
     /**
-     * @struct TamanhoDoNovelo
-     * @brief Define uma constante para o tamanho máximo do vetor de visitados.
-     * @details Usado para pré-alocar o vetor que marca as salas já visitadas.
+     * @brief Descrição textual de um tipo de acontecimento.
+     * @param tipo O tipo do acontecimento.
+     * @return Um texto estático (não alocado) com a descrição.
      */
-    struct TamanhoDoNovelo {
-    static const int tamanhoNovelo = 1000;
-    };
+    static const char* descricao(TipoAcontecimento tipo);
 
     /**
      * @brief Construtor da classe Prisioneiro.
      * @param posInicial O vértice (sala) onde o prisioneiro inicia sua jornada.
      * @param supDias A quantidade inicial de kits de comida que o prisioneiro carrega.
+     * @param numSalas O número de salas do labirinto (dimensiona o mapa de visitados).
+     * @param politica A política de exploração (padrão: DFS).
+     * @param seed A semente do gerador da política aleatória (independente da seed da simulação).
+     * @param registro O que é gravado durante a jornada (padrão: tudo).
+     */
+    Prisioneiro(int posInicial, int supDias, int numSalas,
+                PoliticaExploracao politica = PoliticaExploracao::DFS, unsigned int seed = 1,
+                NivelRegistro registro = NivelRegistro::COMPLETO);
+
+    /**
+     * @brief Recomeça a jornada no mesmo labirinto, como um prisioneiro recém-construído.
+     * @details Reaproveita o que já está alocado: o mapa de visitados é zerado no lugar,
+     * os cursores são descartados em O(1) e o novelo mantém a capacidade reservada.
+     * @param posInicial O vértice (sala) onde o prisioneiro inicia a nova jornada.
+     * @param supDias A quantidade inicial de kits de comida.
+     * @param politica A política de exploração.
+     * @param seed A semente do gerador da política aleatória.
+     * @param registro O que é gravado durante a jornada.
+     */
+    void reiniciar(int posInicial, int supDias, PoliticaExploracao politica, unsigned int seed, NivelRegistro registro);
+
+    /**
+     * @brief Obtém o número de salas para o qual o prisioneiro foi dimensionado.
      */
-    Prisioneiro(int posInicial, int supDias);
+    int getNumSalas() const { return visitados.tamanho(); }
 
     /**
      * @brief Adiciona um acontecimento ao histórico detalhado do prisioneiro.
+     * @details Ignorado com o registro `DESLIGADO`.
      * @param tipo A categoria do evento.
-     * @param descricao Uma descrição textual do evento.
      * @param posicao A sala onde o evento ocorreu.
      * @param tempo O custo associado ao evento.
      */
-    void registrarAcontecimento(const std::string& tipo, const std::string& descricao, int posicao, int tempo);
+    void registrarAcontecimento(TipoAcontecimento tipo, int posicao, int tempo);
+
+    /**
+     * @brief Obtém o histórico de acontecimentos.
+     * @return Os registros, na ordem em que ocorreram.
+     */
+    const std::vector<HistoricoPrisioneiro>& getHistorico() const { return historico; }
+
+    /**
+     * @brief Bytes reservados pelo novelo (pilha de backtracking).
+     */
+    size_t bytesNovelo() const { return novelo.bytesAlocados(); }
 
     /**
      * @brief Destrutor da classe Prisioneiro.
@@ -70,10 +137,19 @@ public:
     /**
      * @brief Executa a lógica de movimento do prisioneiro para um novo vértice.
      * @details Prioriza mover-se para uma sala adjacente não visitada. Se não houver, tenta o backtracking.
-     * @param vizinhos A lista de adjacências do vértice atual.
+     * A varredura de cada sala retoma de onde parou na visita anterior (cursor por sala).
+     * @param vizinhos A vizinhança compacta do vértice atual (`Grafo::vizinhanca`; sempre a mesma para a
+     * mesma sala, até a próxima chamada de `invalidarCursores`).
      * @return O custo (peso da aresta) do movimento realizado. Retorna 0 se nenhum movimento for possível.
      */
-    int mover(const listaAdj<MeuPair<int, int>>& vizinhos);
+    int mover(const Grafo::Vizinhanca& vizinhos);
+
+    /**
+     * @brief Descarta os cursores de vizinhança de todas as salas em O(1).
+     * @details Deve ser chamado quando o labirinto muda (corredor aberto, removido ou
+     * com peso alterado): as próximas varreduras recomeçam do início das listas.
+     */
+    void invalidarCursores() { geracaoAtual++; }
 
     /**
      * @brief Obtém a posição atual (vértice) do prisioneiro.
@@ -83,9 +159,23 @@ public:
 
     /**
      * @brief Obtém o caminho percorrido pelo prisioneiro.
-     * @return Uma referência constante ao vetor com a sequência de vértices visitados.
+     * @return Uma referência constante à sequência de vértices visitados (vazia se o
+     * registro não for `COMPLETO`).
+     */
+    const CaminhoCompacto& getCaminho() const;
+
+    /**
+     * @brief Entrega o caminho percorrido, sem cópia.
+     * @details O caminho do prisioneiro fica vazio; usado ao final da simulação.
+     * @return O caminho, movido.
+     */
+    CaminhoCompacto extrairCaminho() { return std::move(caminho); }
+
+    /**
+     * @brief Obtém a quantidade de movimentos realizados (avanços e retornos).
+     * @return O número de movimentos, contado em qualquer nível de registro.
      */
-    const std::vector<int>& getCaminho() const;
+    int getNumMovimentos() const { return numMovimentos; }
 
     /**
      * @brief Obtém a quantidade de kits de comida restantes.
@@ -102,9 +192,10 @@ public:
 
     /**
      * @brief Executa a lógica de backtracking para a sala anterior.
+     * @param vizinhos A vizinhança compacta da sala atual, onde o corredor de volta é conferido.
      * @return O custo do movimento de retorno. Retorna 0 se não for possível voltar.
      */
-    int voltarAtras();
+    int voltarAtras(const Grafo::Vizinhanca& vizinhos);
 
     /**
      * @brief Obtém o tempo global da simulação na perspectiva do prisioneiro.
@@ -119,11 +210,50 @@ public:
     void setTempoPrisioneiro(int tempo) { tempoPrisioneiro = tempo; }
 
 private:
+    /**
+     * @brief Escolhe o próximo vizinho segundo a política `P`.
+     * @return O índice do vizinho escolhido na lista, ou -1 se não houver candidato.
+     */
+    template <PoliticaExploracao P>
+    int escolherVizinho(const Grafo::Vizinhanca& vizinhos);
+
+    /**
+     * @brief Candidatos entre os vizinhos [i, i + LARGURA_SIMD): bit k ligado se o vizinho
+     * i + k não foi visitado e custa no máximo `custoMaximo`.
+     */
+    unsigned mascaraCandidatos(const Grafo::Vizinhanca& vizinhos, int i, int custoMaximo) const;
+
+    // Vizinhos examinados por mascaraCandidatos (AVX2: 8; SSE2 e escalar: 4)
+#if defined(__AVX2__)
+    static constexpr int LARGURA_SIMD = 8;
+#else
+    static constexpr int LARGURA_SIMD = 4;
+#endif
+    static_assert(LARGURA_SIMD <= Grafo::PREENCHIMENTO_SIMD, "leituras além do fim do CSR");
+
+    /// @brief Conta o movimento para `pos` e o grava no caminho, conforme o registro.
+    void registrarPasso() {
+        numMovimentos++;
+        if (registro == NivelRegistro::COMPLETO) caminho.adicionar(pos);
+    }
+
     int pos; // Vértice atual do prisioneiro
     int kitsDeComida; // Número de kits de comida disponíveis
     int tempoPrisioneiro; // Tempo atual do prisioneiro
     Novelo<MeuPair<int, int>> novelo; // Simula o fio de lã para o backtracking
-    std::vector<int> caminho; // Histórico dos vértices visitados
+    int custoVolta = 0; // soma dos pesos no novelo: kits para voltar até a entrada
+    CaminhoCompacto caminho; // Histórico dos vértices visitados (registro COMPLETO)
     std::vector<HistoricoPrisioneiro> historico; // Histórico detalhado dos acontecimentos
-    std::vector<bool> visitados; // Marca os vértices já visitados
+    NivelRegistro registro; // o que é gravado durante a jornada
+    int numMovimentos = 0; // avanços e retornos realizados
+    MapaDeBits visitados; // Marca os vértices já visitados (um bit por sala)
+
+    // Cursor de vizinhança por sala (Trémaux): próximo vizinho a examinar. Um vizinho
+    // descartado nunca volta a servir, pois visitados só crescem e kits só diminuem.
+    std::vector<int> cursorVizinho; // índice na lista de adjacência da sala
+    std::vector<unsigned int> geracaoCursor; // cursor válido se igual a geracaoAtual
+    unsigned int geracaoAtual = 1;
+
+    PoliticaExploracao politica; // política de exploração
+    std::mt19937 gerador;        // sorteios da política aleatória
 };
\ No newline at end of file
@@ -0,0 +1,37 @@
+/**
+ * @file SaidaJson.h
+ * @author Thiago Nerton
+ * @brief Escrita do resultado de uma simulação em JSON.
+ * @details Compartilhada pelos modos que imprimem resultados: `--json-only`, `--lote`,
+ * `--batch`, `--serve` e `--json-full`.
+ */
+
+#pragma once
+
+#include <ostream>
+#include <string>
+#include "Simulador.h"
+#include "utils/Estatisticas.h"
+#include "utils/Memoria.h"
+
+/**
+ * @brief Escreve uma string como literal JSON (entre aspas, com escapes).
+ */
+void escreverStringJson(std::ostream& saida, const std::string& texto);
+
+/**
+ * @brief Imprime o resultado em JSON, escrito em fluxo por um `EscritorJson`.
+ * @param saida O fluxo de destino.
+ * @param resultado O resultado da simulação.
+ * @param analise A pré-análise a incluir (ou `nullptr`).
+ * @param linhaUnica `true` para uma linha por resultado (JSON Lines).
+ * @param estatisticas Tempos e contadores a incluir (`--stats`), ou `nullptr`.
+ * @param memoria Contabilidade de memória a incluir (`--memoria`), ou `nullptr`.
+ * @param camposIniciais Membros já formatados que abrem o objeto, sem vírgula final (o
+ * `"arquivo"` de `--batch`, o `"id"` de `--serve`); vazio omite.
+ * @param completo `true` para incluir `motivoFim`, o nível `registro` e, se ele for
+ * completo, `caminhoP`, `caminhoM` e `eventos` (`--json-full`).
+ */
+void imprimirJson(std::ostream& saida, const Simulador::ResultadoSimulacao& resultado, const Simulador::PreAnalise* analise,
+                  bool linhaUnica, const Estatisticas* estatisticas = nullptr, const ContabilidadeMemoria* memoria = nullptr,
+                  const std::string& camposIniciais = "", bool completo = false);
@@ -0,0 +1,132 @@
+/**
+ * @file Servidor.h
+ * @author Thiago Nerton
+ * @brief Definição da classe Servidor, o modo de consultas persistente (flag `--serve`).
+ * @details O servidor recebe pedidos em JSON, um por linha, pela entrada padrão ou por
+ * um socket Unix, e responde cada um com uma linha no formato de `--json-only`. Os
+ * cenários carregados ficam em cache, com a memória do Minotauro já calculada,
+ * indexados pelo hash do conteúdo e descartados pelo menos recentemente usado (LRU).
+ *
+ * Pedido: `{"id": 7, "arquivo": "data/fuga", "seed": 3, "chance": 50}`; em vez de
+ * `arquivo`, o cenário pode vir no campo `cenario`, como texto. `id` (qualquer valor
+ * JSON simples) é devolvido como o primeiro campo da resposta; `seed` e `chance` são
+ * opcionais. Erros produzem `{"id": ..., "erro": "..."}`. O pedido
+ * `{"comando": "encerrar"}` encerra o servidor após as respostas pendentes.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <istream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include "Simulador.h"
+
+/**
+ * @class Servidor
+ * @brief Atende pedidos de simulação concorrentes sobre cenários em cache.
+ */
+class Servidor {
+public:
+    /**
+     * @struct Configuracao
+     * @brief Opções fixas do servidor, aplicadas a todos os cenários.
+     */
+    struct Configuracao {
+        int threads = 0;                // threads de atendimento (<= 0: uma por núcleo)
+        size_t capacidadeCache = 64;    // cenários mantidos em memória
+        bool passeioPonderado = false;  // Minotauro prefere corredores curtos ao vagar
+        PoliticaExploracao politica = PoliticaExploracao::DFS;
+        unsigned int seedPrisioneiro = 1;
+        Minotauro::FilaReparo filaReparo = Minotauro::FilaReparo::FIB_HEAP; // corredores dinâmicos
+        long limiteMemoriaMiB = 0;      // recusa cenários cuja estimativa passa do limite (0: sem limite)
+    };
+
+    explicit Servidor(const Configuracao& configuracao);
+
+    /**
+     * @brief Atende os pedidos de um fluxo até o fim dele (ou até `encerrar`, visto antes
+     * de cada leitura).
+     * @details As respostas são escritas em `saida` à medida que ficam prontas; pedidos
+     * simultâneos podem ser respondidos fora de ordem, e o `id` os identifica.
+     * @return `0` ao terminar normalmente.
+     */
+    int atenderFluxo(std::istream& entrada, std::ostream& saida);
+
+    /**
+     * @brief Atende conexões num socket Unix até receber `encerrar`.
+     * @details Cada conexão envia pedidos e recebe as respostas na mesma conexão. O
+     * arquivo do socket é criado (substituindo um existente) e removido ao final.
+     * @param caminho O caminho do socket.
+     * @return `0` ao terminar normalmente, `1` se o socket não puder ser criado.
+     */
+    int atenderSocket(const std::string& caminho);
+
+    /**
+     * @brief Responde um pedido (uma linha JSON) com uma linha JSON, com a quebra de linha.
+     * @details Pode ser chamada de várias threads ao mesmo tempo.
+     * @param[out] encerrar Recebe `true` se o pedido for o comando `encerrar`.
+     */
+    std::string responder(const std::string& pedido, bool& encerrar);
+
+private:
+    /**
+     * @struct Cenario
+     * @brief Um cenário em cache: o simulador carregado e a memória do Minotauro.
+     * @details Sem corredores dinâmicos, as simulações usam `SimuladorLote` sobre a
+     * memória compartilhada e só leem o cenário; com corredores dinâmicos, `run` altera
+     * o labirinto e as simulações do cenário são serializadas por `trava`.
+     */
+    struct Cenario {
+        std::string conteudo; // comparado no acerto do cache, contra colisões do hash
+        Simulador simulador;
+        std::unique_ptr<Minotauro> memoria; // nula com corredores dinâmicos
+        std::mutex trava;
+    };
+
+    /// @brief Destino das respostas de um pedido (a saída do fluxo ou uma conexão).
+    struct Destino;
+
+    /// @brief Pedido aguardando uma thread de atendimento.
+    struct Tarefa {
+        std::string pedido;
+        std::shared_ptr<Destino> destino;
+    };
+
+    /**
+     * @brief Obtém o cenário do cache ou o carrega (e calcula a memória do Minotauro).
+     * @param conteudo O texto do cenário.
+     * @param nome O nome usado nas mensagens de log.
+     * @param[out] erro O motivo, se o cenário não puder ser usado.
+     * @return O cenário, ou `nullptr` se ele não carregar ou passar do limite de memória.
+     */
+    std::shared_ptr<Cenario> obterCenario(const std::string& conteudo, const std::string& nome, std::string& erro);
+
+    /// @brief Laço das threads de atendimento: consome a fila até ela ser fechada.
+    void atender();
+    /// @brief Enfileira um pedido.
+    void enfileirar(std::string pedido, std::shared_ptr<Destino> destino);
+    /// @brief Fecha a fila: as threads terminam os pedidos restantes e saem.
+    void fecharFila();
+
+    Configuracao configuracao;
+
+    // Cache LRU: a lista vai do mais recente ao mais antigo
+    std::mutex travaCache;
+    std::list<uint64_t> usoRecente;
+    std::unordered_map<uint64_t, std::pair<std::shared_ptr<Cenario>, std::list<uint64_t>::iterator>> cache;
+
+    // Fila de pedidos
+    std::mutex travaFila;
+    std::condition_variable filaMudou;
+    std::deque<Tarefa> fila;
+    bool filaFechada = false;
+    std::atomic<bool> encerrando{false}; // `encerrar` recebido
+};
@@ -6,11 +6,16 @@
  * agentes e determinar o resultado final da simulação.
  */
 
+#pragma once
+
 #include <fstream>
+#include <memory>
+#include <optional>
 #include "Grafo.h"
 #include "Prisioneiro.h"
 #include "Minotauro.h"
 #include "utils/Logger.h"
+#include "utils/Trace.h"
 #include <random>
 
 /**
@@ -32,6 +37,26 @@ public:
         int peso;
     };
 
+    /**
+     * @enum ModoPasseio
+     * @brief Como o Minotauro escolhe o próximo corredor quando vaga sem cheiro.
+     */
+    enum class ModoPasseio {
+        UNIFORME,  // todos os vizinhos com a mesma chance
+        PONDERADO  // chance proporcional a 1/peso (prefere corredores curtos)
+    };
+
+    /**
+     * @struct MudancaCorredor
+     * @brief Mudança agendada de um corredor (seção opcional do arquivo de entrada).
+     */
+    struct MudancaCorredor {
+        double tempo; // instante em que o corredor muda
+        int u;
+        int v;
+        int peso;     // novo peso; <= 0 faz o corredor desabar
+    };
+
     /**
      * @brief Construtor da classe Simulador.
      */
@@ -44,6 +69,15 @@ public:
      */
     bool carregarArquivo(const std::string& nome_arquivo);
 
+    /**
+     * @brief Carrega o cenário a partir de um fluxo no mesmo formato dos arquivos.
+     * @details Usado para cenários gerados em memória (por exemplo, nos benchmarks).
+     * @param entrada O fluxo com o cenário.
+     * @param nome O nome do cenário nas mensagens de log.
+     * @return `true` se o cenário foi carregado com sucesso, `false` caso contrário.
+     */
+    bool carregar(std::istream& entrada, const std::string& nome);
+
     
     /**
      * @struct ResultadoSimulacao
@@ -53,7 +87,7 @@ public:
         bool prisioneiroSobreviveu;
         int diasSobrevividos;
         double tempoReal; // tempo contínuo da simulação
-        std::vector<int> caminhoP;
+        CaminhoCompacto caminhoP; // movido do prisioneiro ao final (vazio sem registro completo)
         std::vector<int> caminhoM;
         std::string motivoFim;
         int kitsRestantes;
@@ -64,8 +98,112 @@ public:
         std::vector<Logger::EventoMovimento> eventos;
         double tempoEncontro = -1.0;
         std::string tipoEncontro; // "sala" ou "aresta"
+        NivelRegistro registro = NivelRegistro::COMPLETO; // com que nível os rastros e eventos foram gravados
+    };
+
+    /**
+     * @struct PreAnalise
+     * @brief Resultado da análise estática do cenário, feita antes do primeiro evento.
+     * @details Usa apenas componentes conexos e distâncias a partir da entrada para
+     * identificar cenários cujo desfecho já está decidido, independentemente da seed
+     * e da chance de batalha.
+     */
+    struct PreAnalise {
+        int numComponentes = 0;      // componentes conexos do labirinto
+        int distSaida = -1;          // distância mínima entrada → saída (-1 se inalcançável)
+        int salasAlcancaveis = 0;    // salas a uma distância da entrada coberta pelos kits
+        bool encontroPossivel = true; // Minotauro pode cruzar o caminho do prisioneiro
+        bool fugaPossivel = true;     // a saída pode ser alcançada com os kits disponíveis
+        /// Sem encontro possível, o desfecho é a trajetória determinística do prisioneiro.
+        bool deterministico() const { return !encontroPossivel; }
     };
 
+    /**
+     * @struct EstimativaMemoria
+     * @brief Memória que `run` precisará, estimada logo após a carga.
+     * @details O grafo é medido; as matrizes do Minotauro (O(V²)) e o novelo são
+     * estimados pelo número de salas. A linha do tempo e o histórico crescem com a
+     * duração da simulação e ficam de fora.
+     */
+    struct EstimativaMemoria {
+        int64_t grafo = 0;
+        int64_t memoriaMinotauro = 0; // 0 se o atalho da pré-análise dispensa o Floyd-Warshall
+        int64_t novelo = 0;
+        int64_t total() const { return grafo + memoriaMinotauro + novelo; }
+    };
+
+    /**
+     * @brief Estima a memória de uma execução de `run` sobre o cenário carregado.
+     * @return Uma struct `EstimativaMemoria`, em bytes.
+     */
+    EstimativaMemoria estimarMemoria() const;
+
+    /**
+     * @brief Analisa o cenário carregado sem simulá-lo.
+     * @return Uma struct `PreAnalise` com limites de alcance e desfechos garantidos.
+     */
+    PreAnalise preAnalisar() const;
+
+    /**
+     * @brief Habilita o atalho da pré-análise em `run`.
+     * @details Quando o encontro é impossível, `run` dispensa o Minotauro (sem
+     * Floyd-Warshall nem eventos dele) e simula só a trajetória do prisioneiro.
+     * Nesse modo `posFinalM`/`caminhoM` refletem o Minotauro parado no covil.
+     */
+    void setAtalhoPreAnalise(bool ativo) { atalhoPreAnalise = ativo; }
+
+    /**
+     * @brief Define a política de exploração do prisioneiro (padrão: DFS).
+     * @param politica A política usada por `Prisioneiro::mover`.
+     * @param seed Semente do gerador próprio do prisioneiro (política aleatória). É
+     * independente da seed de `run`, de modo que a trajetória do prisioneiro continua
+     * a mesma para todas as seeds da simulação.
+     */
+    void setPoliticaPrisioneiro(PoliticaExploracao politica, unsigned int seed = 1) {
+        politicaPrisioneiro = politica;
+        seedPrisioneiro = seed;
+    }
+
+    /**
+     * @brief Define a fila de prioridade do reparo da memória do Minotauro (padrão: FibHeap).
+     * @details Só é usada quando um corredor dinâmico se alonga ou desaba.
+     */
+    void setFilaReparo(Minotauro::FilaReparo fila) { filaReparo = fila; }
+
+    /**
+     * @brief Indica se o cenário tem corredores que mudam durante a simulação.
+     */
+    bool temCorredoresDinamicos() const { return !mudancasCorredores.empty(); }
+
+    /**
+     * @brief Define o que `run` grava durante a simulação (padrão: completo).
+     * @details Com `COMPLETO` o resultado traz os rastros (`caminhoP`, `caminhoM`) e a
+     * linha do tempo (`eventos`); nos demais níveis esses campos ficam vazios e nenhum
+     * movimento aloca memória. Desfecho, tempos e posições não mudam.
+     */
+    void setNivelRegistro(NivelRegistro nivel) { nivelRegistro = nivel; }
+
+    /**
+     * @brief Define o trace que `run` alimenta (`nullptr` desliga; padrão).
+     * @details Com um trace, `run` escreve as fases da memória do Minotauro e do laço
+     * de eventos e, à medida que acontecem, cada deslocamento, encontro e mudança de
+     * corredor, independentemente do nível de registro. O trace não pertence ao simulador.
+     */
+    void setTrace(EscritorTrace* escritor) { trace = escritor; }
+
+    /**
+     * @brief Define o modo do passeio aleatório do Minotauro (padrão: uniforme).
+     */
+    void setModoPasseio(ModoPasseio modo) { modoPasseio = modo; }
+
+    /**
+     * @brief Calcula a memória do Minotauro (Floyd-Warshall) do labirinto carregado.
+     * @details Para motores que a compartilham entre execuções sem alterá-la
+     * (`SimuladorLote`). A memória referencia o labirinto deste simulador, que deve
+     * sobreviver a ela; mudanças de corredor a invalidam.
+     */
+    std::unique_ptr<Minotauro> calcularMemoriaMinotauro() const;
+
     /**
      * @brief Executa o loop principal da simulação.
      * @param seed A semente para o gerador de números aleatórios, para reprodutibilidade.
@@ -81,6 +219,13 @@ public:
     Logger::SimulacaoInfo getSimulacaoInfo() const;
 
 private:
+    // O motor em lote reutiliza o cenário carregado e replica a semântica de `run`
+    friend class SimuladorLote;
+    // A varredura varia os parâmetros do cenário sem recarregá-lo
+    friend class Varredura;
+    // O oráculo de distâncias consulta o labirinto e as salas especiais
+    friend class Oraculo;
+
     /**
      * @brief Verifica se o Minotauro pode detectar o prisioneiro.
      * @return `true` se a distância entre eles for menor ou igual à percepção.
@@ -95,8 +240,9 @@ private:
 
     /**
      * @brief Processa um turno de movimento para o prisioneiro.
+     * @return O custo do movimento realizado (0 se o prisioneiro não conseguiu se mover).
      */
-    void turnoPrisioneiro(Prisioneiro& p);
+    int turnoPrisioneiro(Prisioneiro& p);
 
     /**
      * @brief Processa um turno de movimento para o Minotauro.
@@ -104,11 +250,32 @@ private:
      */
     int turnoMinotauro(Minotauro& m, int posPrisioneiro, std::mt19937& gerador,  bool cheiroDePrisioneiro);
 
+    /**
+     * @brief Sorteia um vizinho de `sala` para o passeio aleatório do Minotauro.
+     * @return A sala sorteada (ou `sala`, se ela não tiver vizinhos).
+     */
+    int sortearVizinho(int sala, std::mt19937& gerador) const;
+
     /**
      * @brief Verifica as condições de fim de jogo após cada evento.
      */
     void verificaEstados(Prisioneiro& p, Minotauro& m, bool& fimDeJogo, bool& minotauroVivo, std::string& motivoFim, unsigned int seed, int chanceBatalha, std::mt19937& gerador);
 
+    /**
+     * @brief Aplica uma mudança de corredor ao labirinto e à memória do Minotauro.
+     */
+    void aplicarMudancaCorredor(const MudancaCorredor& mudanca, Prisioneiro& p, Minotauro& m);
+
+    /**
+     * @brief Registra em `ContabilidadeMemoria` os bytes de cada subsistema.
+     */
+    void registrarMemoria(const Prisioneiro& p, const Minotauro& m) const;
+
+    /**
+     * @brief Restaura o labirinto carregado após uma simulação com corredores dinâmicos.
+     */
+    void restaurarLabirinto();
+
     /**
      * @brief Detecta se os agentes estão se movendo um em direção ao outro na mesma aresta.
      * @param[out] tEncontroOut Parâmetro de saída que receberá o tempo exato do encontro.
@@ -135,6 +302,17 @@ private:
     ResultadoSimulacao resultado; // resultado final da simulação
 
     int kitsDeComida; // kits de comida iniciais do prisioneiro
+    std::vector<MudancaCorredor> mudancasCorredores; // em ordem de tempo
+    std::vector<MudancaCorredor> arestasIniciais;    // arestas do arquivo, na ordem de leitura
+    bool labirintoAlterado = false; // alguma mudança de corredor foi aplicada
+    bool atalhoPreAnalise = false; // dispensa o Minotauro quando o encontro é impossível
+    ModoPasseio modoPasseio = ModoPasseio::UNIFORME; // passeio aleatório do Minotauro
+    PoliticaExploracao politicaPrisioneiro = PoliticaExploracao::DFS; // exploração do prisioneiro
+    unsigned int seedPrisioneiro = 1; // gerador próprio do prisioneiro
+    Minotauro::FilaReparo filaReparo = Minotauro::FilaReparo::FIB_HEAP; // reparo da memória do Minotauro
+    NivelRegistro nivelRegistro = NivelRegistro::COMPLETO; // o que `run` grava
+    EscritorTrace* trace = nullptr; // exportação --trace (não pertence ao simulador)
+    std::optional<Prisioneiro> prisioneiro; // reaproveitado entre execuções de `run`
 
     // Estados da simulação
     double tempoGlobal; // tempo contínuo da simulação
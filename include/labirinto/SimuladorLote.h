@@ -0,0 +1,177 @@
+/**
+ * @file SimuladorLote.h
+ * @author Thiago Nerton
+ * @brief Definição da classe SimuladorLote, que executa várias seeds em paralelo de dados.
+ * @details Para um mesmo labirinto e parâmetros, as seeds só diferem nas escolhas
+ * aleatórias do Minotauro e nos sorteios de batalha. Este motor avança K execuções
+ * independentes em passo único (lockstep), com o estado de cada execução guardado
+ * em vetores paralelos (struct-of-arrays).
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "Simulador.h"
+
+/**
+ * @class SimuladorLote
+ * @brief Motor de simulação em lote com a mesma semântica de `Simulador::run`.
+ * @details A trajetória do prisioneiro não depende do Minotauro (ele não reage ao
+ * predador), então é calculada uma única vez e compartilhada: cada pista (lane)
+ * guarda apenas quantos eventos do prisioneiro já consumiu. O Minotauro e as
+ * memórias de Floyd-Warshall também são compartilhados. A cada rodada todas as
+ * pistas ativas processam exatamente um evento:
+ *  1. seleção do próximo evento, avanço do tempo e do passo do prisioneiro (mínimos e
+ *     seleções sem desvios sobre vetores contíguos das pistas);
+ *  2. processamento do evento (escalar; sorteios usam o gerador de cada pista);
+ *  3. verificação de fim de jogo: o estado da trajetória de cada pista é copiado para
+ *     vetores das pistas, as pistas com fome, fuga ou encontro em sala são marcadas
+ *     sem desvios, e só as marcadas são tratadas;
+ *  4. compactação: pistas encerradas trocam de lugar com a última pista ativa,
+ *     mantendo as ativas contíguas para os laços das fases 1 e 3.
+ *
+ * O ganho sobre `Simulador::run` vem de compartilhar a trajetória e a memória; a fase
+ * 2, que domina o custo de uma rodada, continua escalar por pista (`simulador/lote/`
+ * na bancada mede as duas acelerações).
+ *
+ * O resultado de cada pista é idêntico ao de `Simulador::run` com a mesma seed,
+ * exceto pelos campos de rastro (`caminhoP`, `caminhoM`, `eventos`), que não são
+ * registrados no lote.
+ */
+class SimuladorLote {
+public:
+    /**
+     * @struct Pista
+     * @brief Parâmetros de uma pista: além da seed, os do Minotauro e da batalha podem
+     * variar entre pistas, pois não mudam a trajetória do prisioneiro (varredura, `--sweep`).
+     */
+    struct Pista {
+        unsigned int seed;
+        int chanceBatalha; // chance percentual (1-100) de o prisioneiro vencer um encontro
+        int posIniM;       // sala inicial do Minotauro
+        int percepcao;     // percepção do Minotauro
+    };
+
+    /**
+     * @brief Prepara o lote a partir de um simulador com cenário já carregado.
+     * @details Calcula a memória do Minotauro (Floyd-Warshall) uma única vez.
+     * @param base O simulador cujo cenário (labirinto e parâmetros) será reutilizado.
+     */
+    explicit SimuladorLote(Simulador& base);
+
+    /**
+     * @brief Prepara o lote sobre uma memória do Minotauro já calculada.
+     * @details A memória só é consultada, então vários lotes (inclusive em threads
+     * diferentes) podem compartilhá-la. O atalho da pré-análise não é usado: ele depende
+     * da sala inicial do Minotauro, que varia entre as pistas.
+     * @param base O simulador com o cenário carregado (sem corredores dinâmicos).
+     * @param memoria A memória calculada sobre o mesmo labirinto (`Simulador::calcularMemoriaMinotauro`).
+     * @param kitsDeComida Os kits iniciais do prisioneiro, que definem a trajetória compartilhada.
+     */
+    SimuladorLote(Simulador& base, const Minotauro& memoria, int kitsDeComida);
+
+    /**
+     * @brief Prepara o lote sobre uma memória já calculada, com os kits do cenário.
+     */
+    SimuladorLote(Simulador& base, const Minotauro& memoria) : SimuladorLote(base, memoria, base.kitsDeComida) {}
+
+    /**
+     * @brief Executa uma simulação por seed, todas em lockstep.
+     * @param seeds As seeds das pistas (uma execução por seed).
+     * @param chanceBatalha A chance percentual (1-100) de o prisioneiro vencer um encontro.
+     * @return Um resultado por seed, na mesma ordem de `seeds`.
+     * @note Cenários com corredores dinâmicos são executados seed a seed por `Simulador::run`.
+     */
+    std::vector<Simulador::ResultadoSimulacao> run(const std::vector<unsigned int>& seeds, int chanceBatalha);
+
+    /**
+     * @brief Executa uma simulação por pista, todas em lockstep.
+     * @param pistas Seed, chance de batalha e parâmetros do Minotauro de cada pista.
+     * @return Um resultado por pista, na mesma ordem de `pistas`.
+     * @note Com corredores dinâmicos, as pistas são executadas uma a uma por `Simulador::run`,
+     * que altera temporariamente o simulador base: lotes que rodam em paralelo precisam
+     * de simuladores base distintos nesse caso.
+     */
+    std::vector<Simulador::ResultadoSimulacao> run(const std::vector<Pista>& pistas);
+
+    /**
+     * @brief Compara dois resultados nos campos produzidos pelo lote.
+     * @return `true` se desfecho, tempos, kits, posições e encontro coincidem.
+     */
+    static bool resultadosIguais(const Simulador::ResultadoSimulacao& a, const Simulador::ResultadoSimulacao& b);
+
+private:
+    /// @brief Motivos de fim de jogo, convertidos para o texto de `run` ao final.
+    enum Motivo : uint8_t { NENHUM, FOME, FUGA, DEVORADO, DERROTOU, PRESO };
+    /// @brief Tipo do próximo evento de uma pista.
+    enum Evento : uint8_t { EV_PRISIONEIRO, EV_MINOTAURO, EV_ARESTA };
+
+    /// @brief Grava o estado 0 da trajetória (nenhum evento do prisioneiro processado).
+    void iniciarTrajetoria();
+
+    /**
+     * @brief Garante que a trajetória compartilhada tenha o estado `j`.
+     * @details Avança o prisioneiro de referência sob demanda; o estado `j` é o
+     * estado após `j` eventos do prisioneiro.
+     */
+    void garantirEstado(size_t j);
+
+    /// @brief Copia o estado da trajetória de cada uma das `n` primeiras pistas para os vetores das pistas.
+    void coletarTrajetoria(size_t n);
+
+    /// @brief Evento de chegada do Minotauro para a pista `i` (mesma lógica de `turnoMinotauro`).
+    void eventoMinotauro(size_t i);
+    /// @brief Agenda o encontro em aresta da pista `i`, se houver (mesma lógica de `run`).
+    void agendarEncontroEmAresta(size_t i);
+    /// @brief Sorteia a batalha da pista `i`.
+    bool batalha(size_t i);
+    /// @brief Encerra a pista `i` com o motivo dado.
+    void encerrar(size_t i, Motivo motivo, bool sobreviveu);
+    /// @brief Troca os estados das pistas `a` e `b` (compactação).
+    void trocarPistas(size_t a, size_t b);
+
+    Simulador& base;
+    Minotauro memoriaPropria; // Floyd-Warshall do lote (vazia com memória externa)
+    const Minotauro& memoria; // memória de caminhos compartilhada por todas as pistas
+    bool minotauroIrrelevante; // atalho da pré-análise habilitado no simulador base
+    int kitsIniciais;          // kits do prisioneiro de referência
+
+    // --- Trajetória compartilhada do prisioneiro (struct-of-arrays) ---
+    Prisioneiro prisioneiro;      // prisioneiro de referência, avançado sob demanda
+    std::vector<int> trajPos;     // sala atual
+    std::vector<int> trajKits;    // kits restantes
+    std::vector<int> trajUltPos;  // sala antes do último deslocamento
+    std::vector<int> trajCusto;   // custo do último movimento (0: não se moveu)
+    std::vector<double> trajIni;  // início do último deslocamento
+    std::vector<double> trajPrx;  // instante do próximo evento do prisioneiro
+    std::vector<int> trajFim;     // FOME/FUGA se `verificaEstados` encerra neste estado
+
+    // --- Estado das pistas (struct-of-arrays), ativas em [0, numAtivas) ---
+    // Marcas e tipos lidos nos laços das fases 1 e 3 são int, não uint8_t: com larguras
+    // de 32 e 64 bits no mesmo laço o compilador ainda vetoriza.
+    size_t numAtivas = 0;
+    std::vector<int> chance;       // chance de batalha da pista
+    std::vector<int> percepcao;    // percepção do Minotauro da pista
+    std::vector<size_t> idPista;   // índice original (posição em `seeds`)
+    std::vector<double> tempo;     // tempo global da pista
+    std::vector<int> passoP;       // eventos do prisioneiro consumidos
+    std::vector<int> posM, ultM, destM;
+    std::vector<double> prxM, iniM;
+    std::vector<int> vivo;         // Minotauro participa (local `minotauroVivo` de `run`)
+    std::vector<uint8_t> vivoRes;  // `resultado.minotauroVivo`
+    std::vector<double> tAresta;   // encontro em aresta agendado (INF: nenhum)
+    std::vector<double> tEncontro;
+    std::vector<uint8_t> tipoEncontro; // 0: nenhum, 1: sala, 2: aresta
+    std::vector<int> tipoEvento;
+    std::vector<int> motivo;
+    std::vector<int> marca;        // fase 3: pista com fome, fuga ou encontro em sala
+    // Estado da trajetória em que cada pista está (cópia de trajPrx/trajPos/trajFim)
+    std::vector<double> pistaPrxP;
+    std::vector<int> pistaPosP;
+    std::vector<int> pistaFimP;
+    std::vector<std::mt19937> gerador;
+
+    std::vector<Simulador::ResultadoSimulacao> resultados;
+};
@@ -0,0 +1,92 @@
+/**
+ * @file Varredura.h
+ * @author Thiago Nerton
+ * @brief Definição da classe Varredura, que simula uma grade de parâmetros (flag `--sweep`).
+ * @details Numa varredura o labirinto é carregado uma única vez e os parâmetros
+ * `percepcaoMinotauro`, `kitsDeComida`, `posIniM` e `chanceBatalha` percorrem intervalos.
+ * Nenhum deles muda os caminhos mínimos, então o Floyd-Warshall é calculado uma única
+ * vez para a grade inteira. A trajetória do prisioneiro só depende dos kits: os pontos
+ * com os mesmos kits viram pistas de um mesmo `SimuladorLote`, que a compartilha.
+ */
+
+#pragma once
+
+#include <array>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "Simulador.h"
+
+/**
+ * @class Varredura
+ * @brief Executa todas as combinações de uma grade de parâmetros sobre um cenário carregado.
+ */
+class Varredura {
+public:
+    /**
+     * @enum Parametro
+     * @brief Os parâmetros que podem variar, na ordem das colunas da tabela.
+     */
+    enum Parametro : int {
+        PERCEPCAO,      // percepcaoMinotauro
+        KITS,           // kitsDeComida
+        POS_INI_M,      // posIniM
+        CHANCE,         // chanceBatalha
+        NUM_PARAMETROS
+    };
+
+    /**
+     * @struct Ponto
+     * @brief Um ponto da grade e o resumo das suas execuções (uma por seed).
+     */
+    struct Ponto {
+        std::array<int, NUM_PARAMETROS> parametros{};
+        int execucoes = 0;
+        int sobrevivencias = 0;
+        int encontros = 0;      // execuções com encontro (em sala ou em corredor)
+        double tempoMedio = 0.0; // média de `tempoReal`
+    };
+
+    /**
+     * @brief Cria a varredura com cada parâmetro fixo no valor do cenário.
+     * @param base O simulador com o cenário carregado; os parâmetros são restaurados após `run`.
+     * @param chanceBatalha A chance de batalha usada quando ela não é varrida.
+     */
+    Varredura(Simulador& base, int chanceBatalha);
+
+    /**
+     * @brief Define os intervalos a partir de uma especificação.
+     * @details Formato: `nome=valor` ou `nome=inicio:fim[:passo]` (fim incluído), separados
+     * por vírgula; por exemplo `percepcaoMinotauro=1:6,kitsDeComida=10:40:10`. Parâmetros
+     * não citados mantêm o valor do cenário. Erros são registrados no log.
+     * @param especificacao O texto da flag `--sweep`.
+     * @return `false` se a especificação for inválida (nome, intervalo ou sala inexistente).
+     */
+    bool definir(const std::string& especificacao);
+
+    /**
+     * @brief Número de pontos da grade.
+     */
+    size_t numPontos() const;
+
+    /**
+     * @brief Simula cada ponto da grade com cada seed.
+     * @details As pistas de cada valor de kits são divididas em blocos, executados em
+     * paralelo por um `PoolTrabalho`; todos os blocos consultam a mesma memória do
+     * Minotauro. Com corredores dinâmicos não há memória compartilhada: os pontos são
+     * simulados um a um por `Simulador::run`, na thread chamadora.
+     * @param seeds As seeds de cada ponto.
+     * @param numThreads Threads do pool (<= 0: uma por núcleo).
+     * @return Os pontos, em ordem lexicográfica dos parâmetros (o último varia mais rápido).
+     */
+    std::vector<Ponto> run(const std::vector<unsigned int>& seeds, int numThreads);
+
+    /**
+     * @brief Imprime os pontos como tabela separada por tabulações, com cabeçalho.
+     */
+    static void imprimirTabela(std::ostream& saida, const std::vector<Ponto>& pontos);
+
+private:
+    Simulador& base;
+    std::array<std::vector<int>, NUM_PARAMETROS> valores; // valores de cada parâmetro, em ordem
+};
@@ -0,0 +1,195 @@
+/**
+ * @file EscritorJson.h
+ * @brief Escritor de JSON em fluxo, com buffer próprio (saídas `--json-only` e `--json-full`).
+ * @details Os valores vão direto para um buffer fixo, descarregado no `std::ostream` de
+ * destino quando enche e na destruição; nada é montado em strings intermediárias, então
+ * arrays longos (caminhos, linha do tempo) custam só a sua escrita. Os números são
+ * formatados com `std::to_chars`, sem locale nem estado de fluxo; os reais mantêm o
+ * formato fixo de 6 casas das saídas existentes, e os não finitos, que o JSON não
+ * representa, saem como `null`.
+ *
+ * O layout é o das saídas do simulador: o objeto de nível 1 tem um membro por linha
+ * (`indentado`) ou todos numa linha; objetos aninhados ficam em uma linha, `{ "a": 1 }`.
+ */
+
+#pragma once
+
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string_view>
+
+/**
+ * @brief Escreve `texto` com os escapes de uma string JSON (sem as aspas).
+ * @details Aspas, barras invertidas e caracteres de controle são escapados; os trechos
+ * sem escapes são entregues inteiros a `escrever(const char*, size_t)`.
+ */
+template <class Escrever>
+void escaparJson(std::string_view texto, Escrever&& escrever) {
+    static constexpr char HEX[] = "0123456789abcdef";
+    size_t inicio = 0;
+    for (size_t i = 0; i < texto.size(); ++i) {
+        const unsigned char c = static_cast<unsigned char>(texto[i]);
+        if (c >= 0x20 && c != '"' && c != '\\') continue;
+        escrever(texto.data() + inicio, i - inicio);
+        if (c < 0x20) {
+            const char escape[6] = {'\\', 'u', '0', '0', HEX[c >> 4], HEX[c & 0xF]};
+            escrever(escape, sizeof(escape));
+        } else {
+            const char escape[2] = {'\\', static_cast<char>(c)};
+            escrever(escape, sizeof(escape));
+        }
+        inicio = i + 1;
+    }
+    escrever(texto.data() + inicio, texto.size() - inicio);
+}
+
+/**
+ * @class EscritorJson
+ * @brief Escreve um documento JSON em fluxo, cuidando das vírgulas e do layout.
+ * @details Uso: `abrirObjeto()`, pares `chave(...)` + `valor(...)` (ou um contêiner
+ * aberto após a chave), `fecharObjeto()`. Dentro de arrays, `valor` e `abrir*` são
+ * os elementos. O escritor não valida a estrutura.
+ */
+class EscritorJson {
+public:
+    /**
+     * @param destino O fluxo que recebe o texto.
+     * @param indentado `true` para um membro por linha no objeto de nível 1.
+     */
+    explicit EscritorJson(std::ostream& destino, bool indentado = false) : destino(destino), indentado(indentado) {}
+    ~EscritorJson() { descarregar(); }
+
+    EscritorJson(const EscritorJson&) = delete;
+    EscritorJson& operator=(const EscritorJson&) = delete;
+
+    void abrirObjeto() { abrir('{'); }
+    void fecharObjeto() { fechar('}'); }
+    void abrirArray() { abrir('['); }
+    void fecharArray() { fechar(']'); }
+
+    /**
+     * @brief Escreve a chave do próximo membro do objeto aberto.
+     * @param nome O nome, escrito sem escapes (use apenas literais simples).
+     */
+    EscritorJson& chave(std::string_view nome) {
+        separador();
+        bruto('"');
+        bruto(nome);
+        bruto("\": ");
+        aposChave = true;
+        return *this;
+    }
+
+    void valor(bool v) { elemento(); bruto(v ? std::string_view("true") : std::string_view("false")); }
+    void valor(int v) { elemento(); numero(v); }
+    void valor(int64_t v) { elemento(); numero(v); }
+    void valor(size_t v) { elemento(); numero(v); }
+    /// @brief Real em notação fixa com 6 casas, como `std::fixed`; NaN e infinitos viram `null`.
+    void valor(double v) {
+        elemento();
+        if (std::isfinite(v)) numero(v, std::chars_format::fixed, 6);
+        else bruto("null");
+    }
+    /// @brief String, entre aspas e com escapes.
+    void valor(std::string_view v) {
+        elemento();
+        bruto('"');
+        escaparJson(v, [this](const char* dados, size_t n) { bruto(std::string_view(dados, n)); });
+        bruto('"');
+    }
+    void valor(const char* v) { valor(std::string_view(v)); }
+    void nulo() { elemento(); bruto("null"); }
+
+    /**
+     * @brief Membros já formatados (`"a": 1, "b": 2`) no objeto aberto; vazio não escreve nada.
+     */
+    void membros(std::string_view texto) {
+        if (texto.empty()) return;
+        separador();
+        bruto(texto);
+    }
+
+    /// @brief Texto literal, fora da estrutura (por exemplo, a quebra de linha final).
+    void bruto(std::string_view texto) {
+        if (texto.size() > TAMANHO_BUFFER - usado) {
+            descarregar();
+            if (texto.size() > TAMANHO_BUFFER) {
+                destino.write(texto.data(), static_cast<std::streamsize>(texto.size()));
+                return;
+            }
+        }
+        std::memcpy(buffer + usado, texto.data(), texto.size());
+        usado += texto.size();
+    }
+
+    /**
+     * @brief Descarrega o buffer e devolve o fluxo de destino, para escrever nele
+     * diretamente (por exemplo, um `escreverJson(std::ostream&)` existente).
+     */
+    std::ostream& fluxo() {
+        descarregar();
+        return destino;
+    }
+
+    /// @brief Entrega ao destino o que está no buffer.
+    void descarregar() {
+        if (usado == 0) return;
+        destino.write(buffer, static_cast<std::streamsize>(usado));
+        usado = 0;
+    }
+
+private:
+    static constexpr size_t TAMANHO_BUFFER = 8192;
+    static constexpr int PROFUNDIDADE_MAXIMA = 32;
+
+    std::ostream& destino;
+    bool indentado;
+    char buffer[TAMANHO_BUFFER];
+    size_t usado = 0;
+    int nivel = 0;                          // contêineres abertos
+    bool primeiro[PROFUNDIDADE_MAXIMA + 1] = {true}; // o contêiner de cada nível ainda está vazio
+    bool aposChave = false;                 // o próximo valor completa um membro
+
+    void bruto(char c) {
+        if (usado == TAMANHO_BUFFER) descarregar();
+        buffer[usado++] = c;
+    }
+
+    template <class... Formato>
+    void numero(Formato... argumentos) {
+        // 24 caracteres bastam para inteiros de 64 bits; reais em notação fixa podem ter mais
+        char texto[352];
+        const std::to_chars_result r = std::to_chars(texto, texto + sizeof(texto), argumentos...);
+        bruto(std::string_view(texto, static_cast<size_t>(r.ptr - texto)));
+    }
+
+    // Vírgula antes de um membro ou elemento que não seja o primeiro do contêiner
+    void separador() {
+        if (!primeiro[nivel]) bruto(nivel == 1 && indentado ? std::string_view(",\n  ") : std::string_view(", "));
+        primeiro[nivel] = false;
+    }
+
+    // Início de um valor: completa um membro ou é um elemento do array (ou o documento)
+    void elemento() {
+        if (aposChave) aposChave = false;
+        else if (nivel > 0) separador();
+    }
+
+    void abrir(char delimitador) {
+        elemento();
+        bruto(delimitador);
+        if (delimitador == '{') bruto(nivel == 0 ? (indentado ? std::string_view("\n  ") : std::string_view()) : std::string_view(" "));
+        if (nivel < PROFUNDIDADE_MAXIMA) ++nivel;
+        primeiro[nivel] = true;
+    }
+
+    void fechar(char delimitador) {
+        const bool vazio = primeiro[nivel];
+        if (nivel > 0) --nivel;
+        if (delimitador == '}') bruto(nivel == 0 ? (indentado ? std::string_view("\n") : std::string_view()) : (vazio ? std::string_view() : std::string_view(" ")));
+        bruto(delimitador);
+    }
+};
@@ -0,0 +1,116 @@
+/**
+ * @file Estatisticas.h
+ * @brief Tempos por fase e contadores do caminho quente (flag `--stats`).
+ * @details Os tempos são medidos por cronômetros de escopo (`CronometroFase`), uma
+ * leitura de relógio por fase. Os contadores são incrementados pela macro
+ * `LAB_CONTAR`, que some por completo quando o projeto é compilado com
+ * `LABIRINTO_ESTATISTICAS=0` (opção CMake `LABIRINTO_ESTATISTICAS=OFF`).
+ */
+
+#pragma once
+
+#include "utils/EscritorJson.h"
+#include <chrono>
+#include <cstdint>
+
+#ifndef LABIRINTO_ESTATISTICAS
+#define LABIRINTO_ESTATISTICAS 0
+#endif
+
+/**
+ * @struct Estatisticas
+ * @brief Tempos das fases de uma execução e contadores de operações.
+ * @details Há uma instância por thread (`atual()`), zerada por quem inicia a medição.
+ */
+struct Estatisticas {
+    // Tempos por fase, em nanossegundos
+    int64_t nsCarga = 0;            // carregarArquivo
+    int64_t nsMemoriaMinotauro = 0; // lembrarCaminhos (Floyd–Warshall)
+    int64_t nsLacoEventos = 0;      // laço de eventos de `run`
+    int64_t nsRelatorio = 0;        // linha do tempo e relatório humano
+
+    // Contadores do caminho quente (sempre zero se compilados fora)
+    uint64_t eventos = 0;                    // iterações do laço de eventos
+    uint64_t movimentosMinotauro = 0;        // turnos do Minotauro
+    uint64_t verificacoesCheiro = 0;         // consultas de distância para o cheiro
+    uint64_t verificacoesEncontroAresta = 0; // testes de cruzamento no corredor
+    uint64_t backtracks = 0;                 // retornos pelo novelo
+    uint64_t operacoesHeap = 0;              // inserir, diminuirChave e extrairMin
+
+    /// @brief Indica se os contadores foram compilados.
+    static constexpr bool contadoresHabilitados = LABIRINTO_ESTATISTICAS != 0;
+
+    /**
+     * @brief Estatísticas da thread atual.
+     */
+    static Estatisticas& atual() {
+        thread_local Estatisticas estatisticas;
+        return estatisticas;
+    }
+
+    /**
+     * @brief Zera tempos e contadores.
+     */
+    void zerar() { *this = Estatisticas{}; }
+
+    /**
+     * @brief Escreve as estatísticas como um objeto JSON (tempos em milissegundos).
+     * @details Sem contadores compilados, `contadores` é `null`.
+     * @param json O escritor, posicionado depois de uma chave ou dentro de um array.
+     */
+    void escreverJson(EscritorJson& json) const {
+        auto ms = [](int64_t ns) { return static_cast<double>(ns) / 1e6; };
+        json.abrirObjeto();
+        json.chave("tempoMs").abrirObjeto();
+        json.chave("carga").valor(ms(nsCarga));
+        json.chave("memoriaMinotauro").valor(ms(nsMemoriaMinotauro));
+        json.chave("lacoEventos").valor(ms(nsLacoEventos));
+        json.chave("relatorio").valor(ms(nsRelatorio));
+        json.fecharObjeto();
+        json.chave("contadores");
+        if (contadoresHabilitados) {
+            json.abrirObjeto();
+            json.chave("eventos").valor(eventos);
+            json.chave("movimentosMinotauro").valor(movimentosMinotauro);
+            json.chave("verificacoesCheiro").valor(verificacoesCheiro);
+            json.chave("verificacoesEncontroAresta").valor(verificacoesEncontroAresta);
+            json.chave("backtracks").valor(backtracks);
+            json.chave("operacoesHeap").valor(operacoesHeap);
+            json.fecharObjeto();
+        } else {
+            json.nulo();
+        }
+        json.fecharObjeto();
+    }
+};
+
+/**
+ * @class CronometroFase
+ * @brief Soma ao campo indicado o tempo de vida do objeto (cronômetro de escopo).
+ */
+class CronometroFase {
+public:
+    explicit CronometroFase(int64_t& destino) : destino(destino), inicio(std::chrono::steady_clock::now()) {}
+    ~CronometroFase() { parar(); }
+    CronometroFase(const CronometroFase&) = delete;
+    CronometroFase& operator=(const CronometroFase&) = delete;
+
+    /// @brief Encerra a medição antes do fim do escopo (chamadas seguintes não têm efeito).
+    void parar() {
+        if (parado) return;
+        destino += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - inicio).count();
+        parado = true;
+    }
+
+private:
+    int64_t& destino;
+    std::chrono::steady_clock::time_point inicio;
+    bool parado = false;
+};
+
+// Incrementa um contador de Estatisticas::atual(); sem efeito nem custo quando desabilitado
+#if LABIRINTO_ESTATISTICAS
+#define LAB_CONTAR(campo) (++Estatisticas::atual().campo)
+#else
+#define LAB_CONTAR(campo) ((void)0)
+#endif
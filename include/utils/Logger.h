@@ -95,6 +95,16 @@ public:
         currentLevel = level;
     }
 
+    /**
+     * @brief Define o fluxo onde as mensagens de log são escritas (padrão: `std::cout`).
+     * @details Os modos que imprimem JSON Lines em paralelo (`--batch`, `--sweep`) mandam
+     * o log para `std::cerr`, para não intercalá-lo com os resultados.
+     * @param saida O fluxo de destino; deve viver enquanto o Logger for usado.
+     */
+    static void setDestino(std::ostream& saida) {
+        destino = &saida;
+    }
+
     /**
      * @brief Registra uma mensagem de log de depuração.
      * @tparam Args Tipos dos argumentos a serem formatados na mensagem.
@@ -144,8 +154,14 @@ public:
 
     /**
      * @brief Exibe um log animado de todos os eventos de movimento da simulação.
-     * @details Esta função exibe o progresso em tempo real, usando pausas para
-     * criar um efeito de animação. Deve ser chamada no final da simulação.
+     * @details Os eventos viram quadros, produzidos nesta thread numa fila limitada e
+     * desenhados por uma thread de renderização a um quadro a cada `LAB_ANIM_DELAY_MS`
+     * ms (padrão 120; 0 desliga as pausas). Os instantes que caem no mesmo quadro são
+     * agrupados: a animação tem no máximo 400 quadros, qualquer que seja a
+     * duração da simulação. Num terminal, as linhas de progresso ficam fixas abaixo do
+     * log e só as que mudaram são redesenhadas (cursor ANSI); fora dele, cada linha de
+     * progresso é impressa quando muda. Deve ser chamada no final da simulação
+     * (implementação em `Logger.cpp`).
      * @param eventos Um vetor contendo todos os movimentos que ocorreram.
      */
     static void printarLogsComProgresso(const std::vector<EventoMovimento>& eventos);
@@ -190,7 +206,7 @@ private:
                 agentColor = DEFAULT_AGENT_COLOR;
         }
 
-        std::cout << agentColor
+        *destino << agentColor
                   << std::left << std::setw(timeWidth+3) << ("[" + format_time(simulationTime) + "]")
                   << "[" << std::left << std::setw(levelWidth) << levelStrings.at(level) << "] "
                   << format(message, args...)
@@ -233,6 +249,7 @@ private:
 
     // --- Atributos Estáticos ---
     inline static LogLevel currentLevel = LogLevel::DEBUG; // Nível padrão
+    inline static std::ostream* destino = &std::cout; // fluxo das mensagens de log
 
     // Cores para o console
     inline static const char* RESET_COLOR = "\033[0m";
@@ -315,15 +332,13 @@ inline void Logger::imprimirInicioSimulacao(const Logger::SimulacaoInfo& info) {
     for (int v = 0; v < info.labirinto->getNumVertices(); ++v) {
         const auto& vizinhos = info.labirinto->get_vizinhos(v);
         std::cout << STONE << "  ║ " << BRONZE << "• Sala " << BOLD << v << RESET_COLOR << STONE << " se conecta com:" << RESET_COLOR << std::endl;
-        auto no = vizinhos.get_cabeca();
-        if (no == nullptr) {
+        if (vizinhos.vazia()) {
             std::cout << STONE << "  ║    └── Vazio e Silêncio..." << std::endl;
         } else {
-            while (no != nullptr) {
-                const char* connector = (no->prox == nullptr) ? "└──" : "├──";
-                std::cout << STONE << "  ║    " << connector << " Sala " << BOLD << no->dado.primeiro << RESET_COLOR 
-                          << STONE << " (distância: " << no->dado.segundo << ")" << RESET_COLOR << std::endl;
-                no = no->prox;
+            for (int i = 0; i < vizinhos.size(); ++i) {
+                const char* connector = (i + 1 == vizinhos.size()) ? "└──" : "├──";
+                std::cout << STONE << "  ║    " << connector << " Sala " << BOLD << vizinhos[i].primeiro << RESET_COLOR 
+                          << STONE << " (distância: " << vizinhos[i].segundo << ")" << RESET_COLOR << std::endl;
             }
         }
         if (v < info.labirinto->getNumVertices() - 1) {
@@ -333,181 +348,3 @@ inline void Logger::imprimirInicioSimulacao(const Logger::SimulacaoInfo& info) {
     std::cout << STONE <<  "  ╚════════════════════════════════════════════════════════╝" << RESET_COLOR << std::endl;
     std::cout << "\n" << BRONZE << BOLD << "Que os deuses guiem seus passos. A simulação começou!" << RESET_COLOR << std::endl;
 }
-
-inline void Logger::printarLogsComProgresso(const std::vector<EventoMovimento>& eventos) {
-    // Renderização cronológica global: une todos os "ticks" de tempo (início, progresso, chegada)
-    const int barraLen = 20;
-    std::set<double> ticks;
-    ticks.clear();
-    for (const auto& ev : eventos) {
-        ticks.insert(ev.tempoInicio);
-        ticks.insert(ev.tempoFim);
-        // amostragem de progresso para animação
-        double dur = ev.tempoFim - ev.tempoInicio;
-        if (dur <= 0) continue;
-        for (int i = 1; i < barraLen; ++i) {
-            double t = ev.tempoInicio + dur * (double(i) / barraLen);
-            ticks.insert(t);
-        }
-    }
-    std::vector<double> tempoOrdenado(ticks.begin(), ticks.end());
-    std::set<const EventoMovimento*> iniciou;
-    std::set<const EventoMovimento*> chegou;
-
-    std::cout << std::fixed << std::setprecision(2);
-    // Configura atraso via env (LAB_ANIM_DELAY_MS); padrão 120ms
-    auto get_delay_ms = []() -> int {
-        const char* v = std::getenv("LAB_ANIM_DELAY_MS");
-        if (!v) return 120;
-        try {
-            int ms = std::stoi(v);
-            if (ms < 0) ms = 0;
-            if (ms > 2000) ms = 2000;
-            return ms;
-        } catch (...) { return 120; }
-    };
-    const int delay_ms = get_delay_ms();
-
-    for (double t : tempoOrdenado) {
-        // Pequena pausa para efeito de animação
-        std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms));
-
-        // 1) Chegadas neste tempo (fechar deslocamentos antes de iniciar novos no mesmo instante)
-        for (const auto& ev : eventos) {
-            if (std::abs(ev.tempoFim - t) < 1e-9 && !chegou.count(&ev)) {
-                const char* cor = (ev.agente == "Minotauro") ? "\033[38;5;94m" : "\033[1;32m";
-                std::cout << cor << "[TEMPO " << t << "] " << ev.agente << " chegou em " << ev.destino << "\033[0m" << std::endl;
-                chegou.insert(&ev);
-            }
-        }
-
-        // 2) Inícios neste tempo
-        for (const auto& ev : eventos) {
-            if (std::abs(ev.tempoInicio - t) < 1e-9 && !iniciou.count(&ev)) {
-                const char* cor = (ev.agente == "Minotauro") ? "\033[38;5;94m" : "\033[1;32m";
-                std::cout << cor << "[TEMPO " << t << "] " << ev.agente
-                          << " começou a ir de " << ev.origem << " para " << ev.destino
-                          << " (peso: " << ev.peso << ")" << "\033[0m" << std::endl;
-                // std::cout << "    Detalhes: origem=" << ev.origem << ", destino=" << ev.destino << ", peso=" << ev.peso << std::endl;
-                iniciou.insert(&ev);
-            }
-        }
-
-        // 3) Progresso para todos em trânsito neste tempo
-        for (const auto& ev : eventos) {
-            if (t + 1e-9 >= ev.tempoInicio && t <= ev.tempoFim + 1e-9) {
-                double dur = ev.tempoFim - ev.tempoInicio;
-                double frac = (dur > 0) ? std::clamp((t - ev.tempoInicio) / dur, 0.0, 1.0) : 1.0;
-                int filled = (int)std::round(frac * barraLen);
-                int porcento = (int)std::round(frac * 100.0);
-                const char* cor = (ev.agente == "Minotauro") ? "\033[38;5;94m" : "\033[1;32m";
-                std::cout << cor << "[TEMPO " << t << "] " << ev.agente << " progresso: [";
-                for (int b = 0; b < barraLen; ++b) std::cout << (b < filled ? '#' : '-');
-                std::cout << "] " << porcento << "%\033[0m" << std::endl;
-            }
-        }
-    }
-}
-
-inline void Logger::printarLogsComProgresso(const std::vector<EventoMovimento>& eventos,
-                                            double tempoEncontro,
-                                            const std::string& tipoEncontro,
-                                            const std::string& localEncontro) {
-    // Encaminha para a sobrecarga com tempo de corte infinito (compatibilidade)
-    printarLogsComProgresso(eventos, std::numeric_limits<double>::infinity(), tempoEncontro, tipoEncontro, localEncontro);
-}
-
-inline void Logger::printarLogsComProgresso(const std::vector<EventoMovimento>& eventos,
-                                            double tempoCorte,
-                                            double tempoEncontro,
-                                            const std::string& tipoEncontro,
-                                            const std::string& localEncontro) {
-    // Imprime progresso limitado até o tempo do encontro (se houver) e/ou até o fim da simulação
-    const int barraLen = 20;
-    const double tempoMaxEncontro = (tempoEncontro >= 0) ? tempoEncontro : std::numeric_limits<double>::infinity();
-    const double tempoMax = std::min(tempoCorte, tempoMaxEncontro);
-
-    std::set<double> ticks;
-    ticks.clear();
-    for (const auto& ev : eventos) {
-        if (ev.tempoInicio <= tempoMax) ticks.insert(ev.tempoInicio);
-        if (ev.tempoFim <= tempoMax) ticks.insert(ev.tempoFim);
-        // amostragem de progresso para animação, sem ultrapassar o encontro
-        double dur = ev.tempoFim - ev.tempoInicio;
-        if (dur <= 0) continue;
-        for (int i = 1; i < barraLen; ++i) {
-            double t = ev.tempoInicio + dur * (double(i) / barraLen);
-            if (t <= tempoMax + 1e-9) ticks.insert(t);
-        }
-    }
-    std::vector<double> tempoOrdenado(ticks.begin(), ticks.end());
-    std::set<const EventoMovimento*> iniciou;
-    std::set<const EventoMovimento*> chegou;
-
-    std::cout << std::fixed << std::setprecision(2);
-    auto get_delay_ms = []() -> int {
-        const char* v = std::getenv("LAB_ANIM_DELAY_MS");
-        if (!v) return 120;
-        try {
-            int ms = std::stoi(v);
-            if (ms < 0) ms = 0;
-            if (ms > 2000) ms = 2000;
-            return ms;
-        } catch (...) { return 120; }
-    };
-    const int delay_ms = get_delay_ms();
-
-    for (double t : tempoOrdenado) {
-        if (t > tempoMax + 1e-9) break;
-        std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms));
-
-        // 1) Chegadas neste tempo (apenas se a chegada ocorrer antes do encontro)
-        for (const auto& ev : eventos) {
-            if (ev.tempoFim <= tempoMax + 1e-9 && std::abs(ev.tempoFim - t) < 1e-9 && !chegou.count(&ev)) {
-                const char* cor = (ev.agente == "Minotauro") ? "\033[38;5;94m" : "\033[1;32m";
-                std::cout << cor << "[TEMPO " << t << "] " << ev.agente << " chegou em " << ev.destino << "\033[0m" << std::endl;
-                chegou.insert(&ev);
-            }
-        }
-
-        // 2) Inícios neste tempo (desde que antes do encontro)
-        for (const auto& ev : eventos) {
-            if (ev.tempoInicio <= tempoMax + 1e-9 && std::abs(ev.tempoInicio - t) < 1e-9 && !iniciou.count(&ev)) {
-                const char* cor = (ev.agente == "Minotauro") ? "\033[38;5;94m" : "\033[1;32m";
-                std::cout << cor << "[TEMPO " << t << "] " << ev.agente
-                          << " começou a ir de " << ev.origem << " para " << ev.destino
-                          << " (peso: " << ev.peso << ")" << "\033[0m" << std::endl;
-               // std::cout << "    Detalhes: origem=" << ev.origem << ", destino=" << ev.destino << ", peso=" << ev.peso << std::endl;
-                iniciou.insert(&ev);
-            }
-        }
-
-        // 3) Progresso para todos em trânsito neste tempo (cortado no encontro)
-        for (const auto& ev : eventos) {
-            double fimConsiderado = std::min(ev.tempoFim, tempoMax);
-            if (t + 1e-9 >= ev.tempoInicio && t <= fimConsiderado + 1e-9) {
-                double dur = ev.tempoFim - ev.tempoInicio;
-                double frac = (dur > 0) ? std::clamp((t - ev.tempoInicio) / dur, 0.0, 1.0) : 1.0;
-                int filled = (int)std::round(frac * barraLen);
-                int porcento = (int)std::round(frac * 100.0);
-                const char* cor = (ev.agente == "Minotauro") ? "\033[38;5;94m" : "\033[1;32m";
-                std::cout << cor << "[TEMPO " << t << "] " << ev.agente << " progresso: [";
-                for (int b = 0; b < barraLen; ++b) std::cout << (b < filled ? '#' : '-');
-                std::cout << "] " << porcento << "%\033[0m" << std::endl;
-            }
-        }
-    }
-
-    // Destaque do encontro, se houver
-    if (tempoEncontro >= 0) {
-        std::cout << "\n\033[1;31m";
-        std::cout << "      ╔══════════════════════════════════════════════╗\n";
-        std::cout << "      ║             ⚔ ENCONTRO DECISIVO ⚔           ║\n";
-        std::cout << "      ╚══════════════════════════════════════════════╝\n";
-        std::cout << "   » Tipo: " << tipoEncontro << "  •  Tempo: " << std::fixed << std::setprecision(2) << tempoEncontro << "\n";
-        if (!localEncontro.empty()) {
-            std::cout << "   » Local: " << localEncontro << "\n";
-        }
-        std::cout << "\033[0m\n";
-    }
-}
\ No newline at end of file
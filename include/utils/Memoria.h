@@ -0,0 +1,126 @@
+/**
+ * @file Memoria.h
+ * @brief Contabilidade de memória por subsistema e pico de RSS do processo (flag `--memoria`).
+ * @details Cada estrutura grande informa os bytes que ocupa no heap (`bytesAlocados`,
+ * pela capacidade dos vetores, não pelo tamanho); o simulador registra esses valores
+ * nos pontos em que eles mudam (carga, memória do Minotauro, mudanças de corredor e
+ * fim de `run`) e a contabilidade guarda o valor vivo e o pico de cada subsistema.
+ * O pico de RSS vem do sistema operacional (`getrusage`).
+ */
+
+#pragma once
+
+#include "utils/EscritorJson.h"
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+/**
+ * @enum Subsistema
+ * @brief As estruturas cuja memória é contabilizada.
+ */
+enum class Subsistema : int {
+    GRAFO,             // listas de adjacência, CSR e tabelas de alias
+    MEMORIA_MINOTAURO, // matrizes de Floyd–Warshall
+    EVENTOS,           // linha do tempo do resultado (`resultado.eventos`)
+    NOVELO,            // pilha de backtracking do prisioneiro
+    HISTORICO,         // histórico de acontecimentos do prisioneiro
+    QUANTIDADE
+};
+
+/**
+ * @brief Bytes reservados no heap por um vetor (capacidade, não tamanho).
+ */
+template <typename T>
+inline int64_t bytesDeVetor(const std::vector<T>& vetor) {
+    return static_cast<int64_t>(vetor.capacity() * sizeof(T));
+}
+
+/**
+ * @brief Pico de memória residente (RSS) do processo, em bytes; 0 se indisponível.
+ */
+inline int64_t picoRssBytes() {
+#if defined(__APPLE__)
+    rusage uso{};
+    return getrusage(RUSAGE_SELF, &uso) == 0 ? static_cast<int64_t>(uso.ru_maxrss) : 0; // já em bytes
+#elif defined(__unix__)
+    rusage uso{};
+    return getrusage(RUSAGE_SELF, &uso) == 0 ? static_cast<int64_t>(uso.ru_maxrss) * 1024 : 0; // em KiB
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @struct ContabilidadeMemoria
+ * @brief Bytes vivos e pico de cada subsistema.
+ * @details Há uma instância por thread (`atual()`), zerada por quem inicia a medição.
+ */
+struct ContabilidadeMemoria {
+    static constexpr int NUM_SUBSISTEMAS = static_cast<int>(Subsistema::QUANTIDADE);
+
+    std::array<int64_t, NUM_SUBSISTEMAS> bytesVivos{};
+    std::array<int64_t, NUM_SUBSISTEMAS> bytesPico{};
+
+    /**
+     * @brief Contabilidade da thread atual.
+     */
+    static ContabilidadeMemoria& atual() {
+        thread_local ContabilidadeMemoria contabilidade;
+        return contabilidade;
+    }
+
+    /**
+     * @brief Zera valores vivos e picos.
+     */
+    void zerar() { *this = ContabilidadeMemoria{}; }
+
+    /**
+     * @brief Registra quantos bytes o subsistema ocupa agora (e atualiza o seu pico).
+     */
+    void registrar(Subsistema subsistema, int64_t bytes) {
+        const int i = static_cast<int>(subsistema);
+        bytesVivos[i] = bytes;
+        if (bytes > bytesPico[i]) bytesPico[i] = bytes;
+    }
+
+    /**
+     * @brief Soma dos picos de todos os subsistemas.
+     */
+    int64_t picoTotal() const {
+        int64_t total = 0;
+        for (int64_t bytes : bytesPico) total += bytes;
+        return total;
+    }
+
+    /**
+     * @brief Nome do subsistema no JSON.
+     */
+    static const char* nome(int subsistema) {
+        static const char* const nomes[NUM_SUBSISTEMAS] = {"grafo", "memoriaMinotauro", "eventos", "novelo", "historico"};
+        return nomes[subsistema];
+    }
+
+    /**
+     * @brief Escreve a contabilidade como um objeto JSON (bytes vivos e pico por subsistema,
+     * e o pico de RSS do processo no momento da escrita).
+     * @param json O escritor, posicionado depois de uma chave ou dentro de um array.
+     */
+    void escreverJson(EscritorJson& json) const {
+        json.abrirObjeto();
+        json.chave("subsistemas").abrirObjeto();
+        for (int i = 0; i < NUM_SUBSISTEMAS; ++i) {
+            json.chave(nome(i)).abrirObjeto();
+            json.chave("vivos").valor(bytesVivos[i]);
+            json.chave("pico").valor(bytesPico[i]);
+            json.fecharObjeto();
+        }
+        json.fecharObjeto();
+        json.chave("picoRssBytes").valor(picoRssBytes());
+        json.fecharObjeto();
+    }
+};
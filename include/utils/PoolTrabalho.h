@@ -0,0 +1,94 @@
+/**
+ * @file PoolTrabalho.h
+ * @brief Pool de threads com roubo de trabalho (work stealing) para um lote fixo de tarefas.
+ * @details Usado pelos modos `--batch`, `--sweep` e `--query`: as tarefas são índices conhecidos de
+ * antemão, distribuídos em rodízio, na ordem dada, entre as filas das threads. Cada
+ * thread consome a própria fila pelo início e, quando ela esvazia, rouba do fim da fila
+ * de outra thread. Com a ordem "maiores primeiro", cada thread começa por uma tarefa
+ * grande e as pequenas, roubadas no fim, equilibram a cauda.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class PoolTrabalho
+ * @brief Executa tarefas indexadas em várias threads, com roubo de trabalho.
+ */
+class PoolTrabalho {
+public:
+    /**
+     * @brief Cria o pool.
+     * @param numThreads Quantidade de threads; <= 0 usa `std::thread::hardware_concurrency()`.
+     */
+    explicit PoolTrabalho(int numThreads) : numThreads(numThreads) {
+        if (this->numThreads <= 0) this->numThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+
+    /// @brief Número de threads usadas por `executar`.
+    int getNumThreads() const { return numThreads; }
+
+    /**
+     * @brief Executa `tarefa(indice)` para cada índice de `ordem` e espera todas terminarem.
+     * @details A ordem só define a distribuição inicial e a prioridade dentro de cada
+     * fila; tarefas de threads diferentes terminam em qualquer ordem. `tarefa` é chamada
+     * concorrentemente e não deve lançar exceções.
+     * @param ordem Os índices das tarefas, na ordem de prioridade.
+     * @param tarefa Chamável com um `int` (o índice).
+     */
+    template <typename Tarefa>
+    void executar(const std::vector<int>& ordem, Tarefa&& tarefa) {
+        const int n = std::min<int>(numThreads, std::max<int>(1, static_cast<int>(ordem.size())));
+        std::vector<std::unique_ptr<Fila>> filas;
+        for (int t = 0; t < n; ++t) filas.push_back(std::make_unique<Fila>());
+        for (size_t i = 0; i < ordem.size(); ++i) filas[i % n]->indices.push_back(ordem[i]);
+
+        auto trabalhar = [&](int propria) {
+            int indice;
+            while (tirarInicio(*filas[propria], indice) || roubar(filas, propria, indice)) {
+                tarefa(indice);
+            }
+        };
+        std::vector<std::thread> threads;
+        for (int t = 1; t < n; ++t) threads.emplace_back(trabalhar, t);
+        trabalhar(0); // a thread chamadora também trabalha
+        for (auto& thread : threads) thread.join();
+    }
+
+private:
+    struct Fila {
+        std::mutex trava;
+        std::deque<int> indices;
+    };
+
+    int numThreads;
+
+    static bool tirarInicio(Fila& fila, int& indice) {
+        std::lock_guard<std::mutex> guarda(fila.trava);
+        if (fila.indices.empty()) return false;
+        indice = fila.indices.front();
+        fila.indices.pop_front();
+        return true;
+    }
+
+    // Rouba do fim da fila de outra thread. Como nenhuma tarefa nova é criada, filas
+    // todas vazias significam que não há mais trabalho para esta thread.
+    static bool roubar(std::vector<std::unique_ptr<Fila>>& filas, int propria, int& indice) {
+        const int n = static_cast<int>(filas.size());
+        for (int k = 1; k < n; ++k) {
+            Fila& vitima = *filas[(propria + k) % n];
+            std::lock_guard<std::mutex> guarda(vitima.trava);
+            if (vitima.indices.empty()) continue;
+            indice = vitima.indices.back();
+            vitima.indices.pop_back();
+            return true;
+        }
+        return false;
+    }
+};
@@ -0,0 +1,152 @@
+/**
+ * @file Trace.h
+ * @brief Exportação em Chrome trace-event JSON (flag `--trace`), legível no Perfetto
+ * (ui.perfetto.dev) e em `chrome://tracing`.
+ * @details O arquivo tem duas trilhas (processos do trace):
+ * - "motor": intervalos de relógio real das fases (carga, memória do Minotauro, laço de
+ *   eventos, relatório), em microssegundos desde a abertura do trace;
+ * - "simulação": a linha do tempo simulada, com cada deslocamento como um intervalo na
+ *   thread do agente e os encontros e mudanças de corredor como eventos instantâneos.
+ *   Uma unidade de tempo simulado é exibida como 1 ms.
+ *
+ * Os eventos são escritos à medida que acontecem num `ofstream` com buffer próprio;
+ * nada é acumulado em memória, então o tamanho do trace não limita a simulação.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <string>
+
+/**
+ * @class EscritorTrace
+ * @brief Escreve eventos de trace em fluxo, num único arquivo JSON.
+ */
+class EscritorTrace {
+public:
+    /// @brief Threads da trilha de simulação.
+    enum class Agente { PRISIONEIRO = 1, MINOTAURO = 2 };
+
+    /**
+     * @brief Abre o arquivo e escreve o cabeçalho e os nomes das trilhas.
+     * @param caminho O arquivo de saída; verifique `aberto()`.
+     */
+    explicit EscritorTrace(const std::string& caminho)
+        : buffer(new char[TAMANHO_BUFFER]), origem(std::chrono::steady_clock::now()) {
+        saida.rdbuf()->pubsetbuf(buffer.get(), TAMANHO_BUFFER); // antes de abrir, para valer
+        saida.open(caminho);
+        if (!saida) return;
+        saida.setf(std::ios::fixed);
+        saida.precision(3);
+        saida << "{ \"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+        metadado("process_name", PID_MOTOR, 0, "motor");
+        metadado("process_name", PID_SIMULACAO, 0, "simulação");
+        metadado("thread_name", PID_MOTOR, 1, "fases");
+        metadado("thread_name", PID_SIMULACAO, static_cast<int>(Agente::PRISIONEIRO), "Prisioneiro");
+        metadado("thread_name", PID_SIMULACAO, static_cast<int>(Agente::MINOTAURO), "Minotauro");
+    }
+
+    /**
+     * @brief Fecha o array de eventos e o arquivo.
+     */
+    ~EscritorTrace() {
+        if (saida) saida << "\n] }\n";
+    }
+
+    EscritorTrace(const EscritorTrace&) = delete;
+    EscritorTrace& operator=(const EscritorTrace&) = delete;
+
+    /**
+     * @brief Indica se o arquivo foi aberto e nenhuma escrita falhou.
+     */
+    bool aberto() const { return static_cast<bool>(saida); }
+
+    /**
+     * @brief Registra uma fase do motor entre dois instantes do relógio real.
+     */
+    void fase(const char* nome, std::chrono::steady_clock::time_point inicio, std::chrono::steady_clock::time_point fim) {
+        separador();
+        saida << "{ \"name\": \"" << nome << "\", \"cat\": \"motor\", \"ph\": \"X\", \"pid\": " << PID_MOTOR
+              << ", \"tid\": 1, \"ts\": " << microssegundos(inicio) << ", \"dur\": "
+              << std::chrono::duration<double, std::micro>(fim - inicio).count() << " }";
+    }
+
+    /**
+     * @brief Registra um deslocamento simulado como intervalo na thread do agente.
+     * @param inicio Tempo simulado da partida.
+     * @param fim Tempo simulado da chegada.
+     */
+    void movimento(Agente agente, double inicio, double fim, int origem, int destino, int peso) {
+        separador();
+        saida << "{ \"name\": \"" << origem << " → " << destino << "\", \"cat\": \"movimento\", \"ph\": \"X\", \"pid\": "
+              << PID_SIMULACAO << ", \"tid\": " << static_cast<int>(agente) << ", \"ts\": " << inicio * US_POR_UNIDADE
+              << ", \"dur\": " << (fim - inicio) * US_POR_UNIDADE << ", \"args\": { \"origem\": " << origem
+              << ", \"destino\": " << destino << ", \"peso\": " << peso << " } }";
+    }
+
+    /**
+     * @brief Registra um acontecimento instantâneo na trilha de simulação (todas as threads).
+     * @param nome O texto exibido (sem aspas nem barras invertidas).
+     * @param t Tempo simulado.
+     */
+    void instante(const std::string& nome, double t) {
+        separador();
+        saida << "{ \"name\": \"" << nome << "\", \"cat\": \"simulacao\", \"ph\": \"i\", \"s\": \"p\", \"pid\": "
+              << PID_SIMULACAO << ", \"tid\": " << static_cast<int>(Agente::PRISIONEIRO)
+              << ", \"ts\": " << t * US_POR_UNIDADE << " }";
+    }
+
+    /**
+     * @class Fase
+     * @brief Registra no trace o tempo de vida do objeto como uma fase do motor.
+     * @details Com `trace` nulo não faz nada, para que o chamador não precise testar.
+     */
+    class Fase {
+    public:
+        Fase(EscritorTrace* trace, const char* nome)
+            : trace(trace), nome(nome), inicio(std::chrono::steady_clock::now()) {}
+        ~Fase() { encerrar(); }
+        Fase(const Fase&) = delete;
+        Fase& operator=(const Fase&) = delete;
+
+        /// @brief Encerra a fase antes do fim do escopo (chamadas seguintes não têm efeito).
+        void encerrar() {
+            if (!trace) return;
+            trace->fase(nome, inicio, std::chrono::steady_clock::now());
+            trace = nullptr;
+        }
+
+    private:
+        EscritorTrace* trace;
+        const char* nome;
+        std::chrono::steady_clock::time_point inicio;
+    };
+
+private:
+    static constexpr int PID_MOTOR = 1;
+    static constexpr int PID_SIMULACAO = 2;
+    static constexpr double US_POR_UNIDADE = 1000.0; // 1 unidade simulada = 1 ms
+    static constexpr std::streamsize TAMANHO_BUFFER = 1 << 20;
+
+    std::unique_ptr<char[]> buffer; // declarado antes de `saida`, que o usa até ser destruída
+    std::ofstream saida;
+    std::chrono::steady_clock::time_point origem;
+    bool primeiro = true;
+
+    void separador() {
+        saida << (primeiro ? "  " : ",\n  ");
+        primeiro = false;
+    }
+
+    double microssegundos(std::chrono::steady_clock::time_point t) const {
+        return std::chrono::duration<double, std::micro>(t - origem).count();
+    }
+
+    void metadado(const char* tipo, int pid, int tid, const char* nome) {
+        separador();
+        saida << "{ \"name\": \"" << tipo << "\", \"ph\": \"M\", \"pid\": " << pid << ", \"tid\": " << tid
+              << ", \"args\": { \"name\": \"" << nome << "\" } }";
+    }
+};
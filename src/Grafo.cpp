@@ -10,8 +10,11 @@
 #include "labirinto/Grafo.h"
 #include "utils/Logger.h"
 #include <iostream>
+#include <queue>
+#include <algorithm>
 #include "estruturas/MinhaListaAdj.h"
 #include "estruturas/MeuPair.h"
+#include "utils/Memoria.h"
 
 /**
  * @brief Construtor padrão da classe Grafo.
@@ -42,6 +45,172 @@ void Grafo::adicionar_aresta(int u, int v, int peso) {
     // Grafo não-direcionado: adiciona a aresta em ambos os sentidos
     adjacencias[u].inserir_no_fim(MeuPair<int, int>(v, peso));
     adjacencias[v].inserir_no_fim(MeuPair<int, int>(u, peso));
+    compacto = false;
+}
+
+/**
+ * @brief Altera o peso de um corredor durante a simulação.
+ * @details Atualiza as duas direções da aresta. Um corredor que se abre é inserido
+ * no fim das listas de adjacência; um que desaba (peso <= 0) é removido delas. Se a
+ * forma compacta existe, só as vizinhanças de u e v são refeitas nela.
+ * @param u O primeiro vértice do corredor.
+ * @param v O segundo vértice do corredor.
+ * @param peso O novo peso; valores <= 0 removem o corredor.
+ * @return O peso anterior do corredor, ou -1 se ele não existia.
+ */
+int Grafo::definirPeso(int u, int v, int peso) {
+    int anterior = -1;
+    auto atualizar = [&](int de, int para) {
+        auto& lista = adjacencias[de];
+        for (int i = 0; i < lista.size(); ++i) {
+            if (lista[i].primeiro == para) {
+                anterior = lista[i].segundo;
+                if (peso > 0) lista[i].segundo = peso;
+                else lista.remover(i);
+                return;
+            }
+        }
+        if (peso > 0) lista.inserir_no_fim(MeuPair<int, int>(para, peso));
+    };
+    atualizar(u, v);
+    atualizar(v, u);
+    if (anterior < 0 && peso > 0) nA++;
+    else if (anterior >= 0 && peso <= 0) nA--;
+    if (compacto && u >= 0 && v >= 0 && u < nV && v < nV) {
+        recompactarSala(u);
+        recompactarSala(v);
+    } else {
+        compacto = false;
+    }
+    return anterior;
+}
+
+/**
+ * @brief Refaz, na forma compacta, a vizinhança de uma sala a partir da sua lista.
+ * @details Só o trecho da sala é reescrito: se o novo grau cabe na capacidade, no
+ * lugar (as entradas liberadas voltam a ser preenchimento); senão o trecho muda para
+ * o fim dos vetores com o dobro da capacidade, e o antigo vira preenchimento até o
+ * próximo `compactar`. O custo é O(grau) amortizado, independente do tamanho do
+ * labirinto. Só a tabela de alias da sala é reconstruída.
+ * @param sala A sala, em [0, nV).
+ */
+void Grafo::recompactarSala(int sala) {
+    const auto& lista = get_vizinhos(sala);
+    const int novoGrau = lista.size();
+    int inicio = inicioVizinhos[sala];
+    if (novoGrau > capacidadeCsr[sala]) {
+        std::fill(idsCsr.begin() + inicio, idsCsr.begin() + inicio + capacidadeCsr[sala], -1);
+        std::fill(pesosCsr.begin() + inicio, pesosCsr.begin() + inicio + capacidadeCsr[sala], INFINITO);
+        const int capacidade = std::max(novoGrau, 2 * capacidadeCsr[sala]);
+        inicio = entradasCsr;
+        entradasCsr += capacidade;
+        // O preenchimento do fim passa a ser o início do novo trecho; o novo fim é preenchido
+        idsCsr.resize(entradasCsr + PREENCHIMENTO_SIMD, -1);
+        pesosCsr.resize(entradasCsr + PREENCHIMENTO_SIMD, INFINITO);
+        aliasProb.resize(entradasCsr, 1.0);
+        aliasIdx.resize(entradasCsr, 0);
+        inicioVizinhos[sala] = inicio;
+        capacidadeCsr[sala] = capacidade;
+    }
+    int k = inicio;
+    for (const auto& vizinho : lista) {
+        idsCsr[k] = vizinho.primeiro;
+        pesosCsr[k] = vizinho.segundo;
+        k++;
+    }
+    for (; k < inicio + grauCsr[sala]; ++k) {
+        idsCsr[k] = -1;
+        pesosCsr[k] = INFINITO;
+    }
+    grauCsr[sala] = novoGrau;
+    construirAlias(sala);
+}
+
+/**
+ * @brief Remove todas as arestas do grafo.
+ * @details Usado para restaurar o labirinto original após uma simulação com
+ * corredores dinâmicos, reinserindo as arestas na ordem do arquivo.
+ */
+void Grafo::limpar() {
+    adjacencias.clear();
+    compacto = false;
+}
+
+/**
+ * @brief Constrói a representação compacta (CSR) das adjacências.
+ * @details Copia as listas de adjacência para dois vetores contíguos (ids dos
+ * vizinhos e pesos, em estrutura de arrays), indexados por `inicioVizinhos` e
+ * preservando a ordem de inserção. Assim o grau de uma sala e o i-ésimo vizinho são
+ * obtidos em O(1), o que torna o passo aleatório do Minotauro um único sorteio
+ * seguido de um acesso indexado, e o filtro do prisioneiro compara vários pesos por
+ * instrução. Também monta as tabelas de alias do passeio ponderado.
+ */
+void Grafo::compactar() {
+    inicioVizinhos.assign(nV, 0);
+    grauCsr.assign(nV, 0);
+    int numEntradas = 0;
+    for (int v = 0; v < nV; ++v) {
+        inicioVizinhos[v] = numEntradas;
+        grauCsr[v] = get_vizinhos(v).size();
+        numEntradas += grauCsr[v];
+    }
+    capacidadeCsr = grauCsr;
+    entradasCsr = numEntradas;
+    idsCsr.assign(numEntradas + PREENCHIMENTO_SIMD, -1);
+    pesosCsr.assign(numEntradas + PREENCHIMENTO_SIMD, INFINITO);
+    for (int v = 0; v < nV; ++v) {
+        int k = inicioVizinhos[v];
+        for (const auto& vizinho : get_vizinhos(v)) {
+            idsCsr[k] = vizinho.primeiro;
+            pesosCsr[k] = vizinho.segundo;
+            k++;
+        }
+    }
+    aliasProb.assign(numEntradas, 1.0);
+    aliasIdx.assign(numEntradas, 0);
+    for (int v = 0; v < nV; ++v) {
+        construirAlias(v);
+    }
+    compacto = true;
+}
+
+/**
+ * @brief Monta a tabela de alias (método de Vose) dos vizinhos de uma sala.
+ * @details Cada vizinho recebe peso 1/peso_aresta, favorecendo corredores curtos.
+ * A amostragem custa um sorteio de coluna e um sorteio de moeda, em O(1).
+ * @param vertice A sala cuja tabela será construída.
+ */
+void Grafo::construirAlias(int vertice) {
+    const int n = grau(vertice);
+    if (n == 0) return;
+    const int* pesos = pesosCsr.data() + inicioVizinhos[vertice];
+    double* prob = aliasProb.data() + inicioVizinhos[vertice];
+    int* alias = aliasIdx.data() + inicioVizinhos[vertice];
+
+    double soma = 0.0;
+    for (int i = 0; i < n; ++i) soma += 1.0 / std::max(1, pesos[i]);
+
+    std::vector<double> escalado(n);
+    std::vector<int> pequenos, grandes;
+    for (int i = 0; i < n; ++i) {
+        escalado[i] = (1.0 / std::max(1, pesos[i])) * n / soma;
+        alias[i] = i;
+        (escalado[i] < 1.0 ? pequenos : grandes).push_back(i);
+    }
+    while (!pequenos.empty() && !grandes.empty()) {
+        int s = pequenos.back(); pequenos.pop_back();
+        int g = grandes.back();
+        prob[s] = escalado[s];
+        alias[s] = g;
+        escalado[g] -= 1.0 - escalado[s];
+        if (escalado[g] < 1.0) {
+            grandes.pop_back();
+            pequenos.push_back(g);
+        }
+    }
+    // Sobras (por arredondamento) ficam sempre na própria coluna
+    for (int g : grandes) prob[g] = 1.0;
+    for (int s : pequenos) prob[s] = 1.0;
 }
 
 /**
@@ -62,22 +231,25 @@ int Grafo::get_saida() const {
 
 /**
  * @brief Obtém o peso de uma aresta específica entre dois vértices.
+ * @details Com corredores paralelos entre u e v, vale o mais curto, o mesmo que
+ * as distâncias mínimas (memória do Minotauro e Dijkstra) consideram.
  * @param u O vértice de origem.
  * @param v O vértice de destino.
- * @return O peso da aresta se ela existir.
+ * @return O menor peso entre as arestas u-v, se alguma existir.
  * @retval -1 Se a aresta entre u e v não for encontrada.
  */
 int Grafo::getPesoAresta(int u, int v) const {
+    int menor = -1;
     auto it = adjacencias.find(u);
     if (it != adjacencias.end()) {
         const auto& lista = it->second;
-        for (auto no = lista.get_cabeca(); no != nullptr; no = no->prox) {
-            if (no->dado.primeiro == v) {
-                return no->dado.segundo; // Retorna o peso da aresta
+        for (const auto& vizinho : lista) {
+            if (vizinho.primeiro == v && (menor < 0 || vizinho.segundo < menor)) {
+                menor = vizinho.segundo;
             }
         }
     }
-    return -1; // Retorna -1 se a aresta não existir
+    return menor; // -1 se a aresta não existir
 }
 
 /**
@@ -94,3 +266,50 @@ const listaAdj<MeuPair<int, int>>& Grafo::get_vizinhos(int vertice) const {
     }
     return vazia;
 }
+
+/**
+ * @brief Rotula as salas pelos componentes conexos do labirinto (busca em largura).
+ * @param[out] rotulo Recebe, para cada sala, o id do seu componente (0-based).
+ * @return O número de componentes conexos.
+ */
+int Grafo::componentes(std::vector<int>& rotulo) const {
+    rotulo.assign(nV, -1);
+    int numComponentes = 0;
+    std::vector<int> fila;
+    fila.reserve(nV);
+    for (int s = 0; s < nV; ++s) {
+        if (rotulo[s] != -1) continue;
+        rotulo[s] = numComponentes;
+        fila.clear();
+        fila.push_back(s);
+        for (size_t i = 0; i < fila.size(); ++i) {
+            for (const auto& vizinho : get_vizinhos(fila[i])) {
+                int v = vizinho.primeiro;
+                if (v >= 0 && v < nV && rotulo[v] == -1) {
+                    rotulo[v] = numComponentes;
+                    fila.push_back(v);
+                }
+            }
+        }
+        numComponentes++;
+    }
+    return numComponentes;
+}
+
+/**
+ * @brief Estima os bytes que o grafo ocupa no heap.
+ * @details Os nós do `unordered_map` são contados como o par chave/lista mais dois
+ * ponteiros (encadeamento e hash), e cada lista soma o bloco alocado quando passa da
+ * capacidade interna. Os vetores do CSR e do alias contam pela capacidade.
+ * @return Os bytes estimados.
+ */
+int64_t Grafo::bytesAlocados() const {
+    using No = std::pair<const int, listaAdj<MeuPair<int, int>>>;
+    int64_t total = static_cast<int64_t>(adjacencias.bucket_count() * sizeof(void*))
+                  + static_cast<int64_t>(adjacencias.size() * (sizeof(No) + 2 * sizeof(void*)));
+    for (const auto& par : adjacencias) {
+        total += static_cast<int64_t>(par.second.bytesNoHeap());
+    }
+    return total + bytesDeVetor(inicioVizinhos) + bytesDeVetor(grauCsr) + bytesDeVetor(capacidadeCsr) + bytesDeVetor(idsCsr) + bytesDeVetor(pesosCsr)
+                 + bytesDeVetor(aliasProb) + bytesDeVetor(aliasIdx);
+}
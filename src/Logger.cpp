@@ -0,0 +1,320 @@
+/**
+ * @file Logger.cpp
+ * @author Thiago Nerton
+ * @brief Linha do tempo animada do relatório humano (`Logger::printarLogsComProgresso`).
+ * @details A animação é um pipeline de duas threads:
+ * - a chamadora ordena uma única vez os inícios e as chegadas dos deslocamentos e
+ *   produz quadros numa fila limitada; cada quadro cobre um intervalo fixo de tempo
+ *   simulado e guarda só índices (os acontecimentos do intervalo e o deslocamento
+ *   corrente de cada agente), sem texto;
+ * - a thread de renderização formata cada quadro num buffer, escreve-o de uma vez e
+ *   espera o instante do quadro seguinte.
+ *
+ * O custo em tempo de parede é o número de quadros vezes o atraso por quadro, e o
+ * número de quadros é limitado, não importa quantos eventos a simulação tenha.
+ */
+
+#include "utils/Logger.h"
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+
+constexpr int TAMANHO_BARRA = 20;
+constexpr int QUADROS_POR_UNIDADE = 5;  // quadros por unidade de tempo simulado
+constexpr int MAX_QUADROS = 400;        // teto da animação (48 s no atraso padrão)
+constexpr int ATRASO_PADRAO_MS = 120;
+constexpr size_t CAPACIDADE_FILA = 64;  // quadros produzidos à frente do desenho
+constexpr double EPS = 1e-9;
+
+const char* const COR_PRISIONEIRO = "\033[1;32m";
+const char* const COR_MINOTAURO = "\033[38;5;94m";
+const char* const SEM_COR = "\033[0m";
+
+// Atraso entre quadros, de LAB_ANIM_DELAY_MS (0 a 2000 ms)
+int atrasoQuadroMs() {
+    const char* v = std::getenv("LAB_ANIM_DELAY_MS");
+    if (!v) return ATRASO_PADRAO_MS;
+    try {
+        return std::clamp(std::stoi(v), 0, 2000);
+    } catch (...) {
+        return ATRASO_PADRAO_MS;
+    }
+}
+
+// Início ou chegada de um deslocamento. Ordem: tempo, chegadas antes de inícios no
+// mesmo instante, ordem de registro.
+struct Acontecimento {
+    double t;
+    bool inicio;
+    int evento;
+};
+
+// Um quadro: os acontecimentos [primeiro, fim) e o deslocamento corrente de cada agente
+struct Quadro {
+    double t;
+    size_t primeiro;
+    size_t fim;
+    std::vector<int> correntes; // por agente, na ordem de `agentes` (-1: ainda parado)
+};
+
+// Fila limitada entre a produção e o desenho dos quadros
+class FilaQuadros {
+public:
+    void produzir(Quadro quadro) {
+        std::unique_lock<std::mutex> trava(mutex);
+        espaco.wait(trava, [&] { return fila.size() < CAPACIDADE_FILA; });
+        fila.push_back(std::move(quadro));
+        disponivel.notify_one();
+    }
+
+    void fechar() {
+        std::lock_guard<std::mutex> trava(mutex);
+        fechada = true;
+        disponivel.notify_one();
+    }
+
+    // `false` quando a fila foi fechada e esvaziada
+    bool consumir(Quadro& quadro) {
+        std::unique_lock<std::mutex> trava(mutex);
+        disponivel.wait(trava, [&] { return !fila.empty() || fechada; });
+        if (fila.empty()) return false;
+        quadro = std::move(fila.front());
+        fila.pop_front();
+        espaco.notify_one();
+        return true;
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable disponivel;
+    std::condition_variable espaco;
+    std::deque<Quadro> fila;
+    bool fechada = false;
+};
+
+// Desenha os quadros no terminal (cursor ANSI) ou em texto corrido
+class Renderizador {
+public:
+    Renderizador(const std::vector<Logger::EventoMovimento>& eventos, const std::vector<Acontecimento>& acontecimentos,
+                 double tempoMax, bool terminal)
+        : eventos(eventos), acontecimentos(acontecimentos), tempoMax(tempoMax), terminal(terminal) {}
+
+    void desenhar(const Quadro& quadro) {
+        texto.clear();
+        for (size_t i = quadro.primeiro; i < quadro.fim; ++i) linhaAcontecimento(acontecimentos[i]);
+        const bool haLog = !texto.empty();
+
+        if (!terminal) {
+            // Texto corrido: a linha de progresso de um agente só quando a barra dele muda.
+            // Cada chegada fecha a barra do deslocamento em 100%, mesmo que o agente já
+            // tenha partido de novo no mesmo quadro.
+            barras.resize(quadro.correntes.size());
+            for (size_t i = quadro.primeiro; i < quadro.fim; ++i) {
+                const Acontecimento& chegada = acontecimentos[i];
+                if (chegada.inicio) continue;
+                const Logger::EventoMovimento& ev = eventos[chegada.evento];
+                for (size_t a = 0; a < quadro.correntes.size(); ++a) {
+                    if (quadro.correntes[a] < 0 || eventos[quadro.correntes[a]].agente != ev.agente) continue;
+                    std::string barra = linhaProgresso(ev, chegada.t);
+                    if (barra != barras[a]) texto += cor(ev) + prefixoTempo(chegada.t) + barra + SEM_COR + "\n";
+                    barras[a] = std::move(barra);
+                    break;
+                }
+            }
+            for (size_t a = 0; a < quadro.correntes.size(); ++a) {
+                if (quadro.correntes[a] < 0) continue;
+                const Logger::EventoMovimento& ev = eventos[quadro.correntes[a]];
+                std::string barra = linhaProgresso(ev, quadro.t);
+                if (barra == barras[a]) continue;
+                texto += cor(ev) + prefixoTempo(quadro.t) + barra + SEM_COR + "\n";
+                barras[a] = std::move(barra);
+            }
+            std::cout.write(texto.data(), static_cast<std::streamsize>(texto.size()));
+            return;
+        }
+
+        // Bloco de progresso: o tempo do quadro e uma linha por agente em movimento
+        std::vector<std::string> linhas;
+        linhas.push_back("  ⏳ TEMPO " + numero(quadro.t));
+        for (int evento : quadro.correntes) {
+            if (evento >= 0) linhas.push_back(cor(eventos[evento]) + linhaProgresso(eventos[evento], quadro.t) + SEM_COR);
+        }
+
+        if (haLog || linhas.size() != bloco.size()) {
+            // O log entra acima do bloco, que é redesenhado inteiro logo abaixo
+            std::string log;
+            log.swap(texto);
+            if (!bloco.empty()) texto += "\033[" + std::to_string(bloco.size()) + "A\r\033[J";
+            texto += log;
+            for (const std::string& linha : linhas) texto += linha + "\n";
+        } else {
+            // Só as linhas que mudaram: sobe até o bloco e desce linha a linha
+            bool mudou = false;
+            for (size_t i = 0; i < linhas.size(); ++i) mudou = mudou || bloco[i] != linhas[i];
+            if (mudou) {
+                texto += "\033[" + std::to_string(bloco.size()) + "A";
+                for (size_t i = 0; i < linhas.size(); ++i) {
+                    if (bloco[i] == linhas[i]) texto += "\033[1B";
+                    else texto += "\r\033[2K" + linhas[i] + "\n";
+                }
+                texto += "\r";
+            }
+        }
+        bloco = std::move(linhas);
+        std::cout.write(texto.data(), static_cast<std::streamsize>(texto.size()));
+    }
+
+private:
+    const std::vector<Logger::EventoMovimento>& eventos;
+    const std::vector<Acontecimento>& acontecimentos;
+    double tempoMax;
+    bool terminal;
+    std::string texto;               // o quadro em formação
+    std::vector<std::string> bloco;  // terminal: o bloco de progresso desenhado por último
+    std::vector<std::string> barras; // texto corrido: a última barra impressa de cada agente
+
+    static std::string numero(double t) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.2f", t);
+        return buffer;
+    }
+
+    static std::string cor(const Logger::EventoMovimento& ev) {
+        return ev.agente == "Minotauro" ? COR_MINOTAURO : COR_PRISIONEIRO;
+    }
+
+    static std::string prefixoTempo(double t) { return "[TEMPO " + numero(t) + "] "; }
+
+    void linhaAcontecimento(const Acontecimento& a) {
+        const Logger::EventoMovimento& ev = eventos[a.evento];
+        texto += cor(ev) + prefixoTempo(a.t) + ev.agente;
+        if (a.inicio) {
+            texto += " começou a ir de " + std::to_string(ev.origem) + " para " + std::to_string(ev.destino)
+                   + " (peso: " + std::to_string(ev.peso) + ")";
+        } else {
+            texto += " chegou em " + std::to_string(ev.destino);
+        }
+        texto += SEM_COR;
+        texto += '\n';
+    }
+
+    // Sem o tempo do quadro, para que a linha só mude quando a barra mudar
+    std::string linhaProgresso(const Logger::EventoMovimento& ev, double t) const {
+        const double dur = ev.tempoFim - ev.tempoInicio;
+        const double frac = dur > 0 ? std::clamp((std::min(t, tempoMax) - ev.tempoInicio) / dur, 0.0, 1.0) : 1.0;
+        const int cheios = static_cast<int>(std::round(frac * TAMANHO_BARRA));
+        std::string linha = ev.agente + " progresso (" + std::to_string(ev.origem) + " → "
+                          + std::to_string(ev.destino) + "): [";
+        linha.append(static_cast<size_t>(cheios), '#');
+        linha.append(static_cast<size_t>(TAMANHO_BARRA - cheios), '-');
+        linha += "] " + std::to_string(static_cast<int>(std::round(frac * 100.0))) + "%";
+        return linha;
+    }
+};
+
+} // namespace
+
+void Logger::printarLogsComProgresso(const std::vector<EventoMovimento>& eventos) {
+    printarLogsComProgresso(eventos, std::numeric_limits<double>::infinity(), -1.0, "", "");
+}
+
+void Logger::printarLogsComProgresso(const std::vector<EventoMovimento>& eventos,
+                                     double tempoEncontro,
+                                     const std::string& tipoEncontro,
+                                     const std::string& localEncontro) {
+    // Encaminha para a sobrecarga com tempo de corte infinito (compatibilidade)
+    printarLogsComProgresso(eventos, std::numeric_limits<double>::infinity(), tempoEncontro, tipoEncontro, localEncontro);
+}
+
+void Logger::printarLogsComProgresso(const std::vector<EventoMovimento>& eventos,
+                                     double tempoCorte,
+                                     double tempoEncontro,
+                                     const std::string& tipoEncontro,
+                                     const std::string& localEncontro) {
+    // Nada é mostrado depois do encontro (se houver) nem do fim da simulação
+    const double tempoMaxEncontro = (tempoEncontro >= 0) ? tempoEncontro : std::numeric_limits<double>::infinity();
+    const double tempoMax = std::min(tempoCorte, tempoMaxEncontro);
+    std::cout << std::fixed << std::setprecision(2); // formato dos tempos no relatório que segue
+
+    // Inícios e chegadas até o corte, em ordem cronológica, e os agentes na ordem em que aparecem
+    std::vector<Acontecimento> acontecimentos;
+    std::vector<std::string> agentes;
+    std::vector<int> agenteDoEvento(eventos.size());
+    double tempoInicial = std::numeric_limits<double>::infinity();
+    double tempoFinal = 0.0;
+    for (size_t i = 0; i < eventos.size(); ++i) {
+        const EventoMovimento& ev = eventos[i];
+        if (ev.tempoInicio > tempoMax + EPS) continue;
+        const auto it = std::find(agentes.begin(), agentes.end(), ev.agente);
+        agenteDoEvento[i] = static_cast<int>(it - agentes.begin());
+        if (it == agentes.end()) agentes.push_back(ev.agente);
+        acontecimentos.push_back(Acontecimento{ev.tempoInicio, true, static_cast<int>(i)});
+        tempoInicial = std::min(tempoInicial, ev.tempoInicio);
+        tempoFinal = std::max(tempoFinal, std::min(ev.tempoFim, tempoMax));
+        if (ev.tempoFim <= tempoMax + EPS) acontecimentos.push_back(Acontecimento{ev.tempoFim, false, static_cast<int>(i)});
+    }
+    std::sort(acontecimentos.begin(), acontecimentos.end(), [](const Acontecimento& a, const Acontecimento& b) {
+        if (std::abs(a.t - b.t) >= EPS) return a.t < b.t;
+        if (a.inicio != b.inicio) return !a.inicio;
+        return a.evento < b.evento;
+    });
+
+    if (!acontecimentos.empty()) {
+        // Intervalo de tempo simulado por quadro: fixo, ou maior se a animação passaria do teto
+        const double duracao = std::max(0.0, tempoFinal - tempoInicial);
+        const double passo = std::max(1.0 / QUADROS_POR_UNIDADE, duracao / MAX_QUADROS);
+        const int numQuadros = static_cast<int>(std::ceil(duracao / passo - EPS));
+        const int atrasoMs = atrasoQuadroMs();
+
+        FilaQuadros fila;
+        Renderizador renderizador(eventos, acontecimentos, tempoMax, isatty(STDOUT_FILENO) != 0);
+        std::thread render([&] {
+            auto proximo = std::chrono::steady_clock::now();
+            Quadro quadro;
+            while (fila.consumir(quadro)) {
+                if (atrasoMs > 0) {
+                    std::this_thread::sleep_until(proximo);
+                    proximo += std::chrono::milliseconds(atrasoMs);
+                }
+                renderizador.desenhar(quadro);
+                if (atrasoMs > 0) std::cout.flush();
+            }
+            std::cout.flush();
+        });
+
+        // Produção: cada quadro leva os acontecimentos até o seu instante
+        std::vector<int> correntes(agentes.size(), -1);
+        size_t proximoAcontecimento = 0;
+        for (int q = 0; q <= numQuadros; ++q) {
+            const double t = q == numQuadros ? tempoFinal : tempoInicial + q * passo;
+            Quadro quadro{t, proximoAcontecimento, proximoAcontecimento, {}};
+            while (proximoAcontecimento < acontecimentos.size() && acontecimentos[proximoAcontecimento].t <= t + EPS) {
+                const Acontecimento& a = acontecimentos[proximoAcontecimento++];
+                if (a.inicio) correntes[agenteDoEvento[a.evento]] = a.evento;
+            }
+            quadro.fim = proximoAcontecimento;
+            quadro.correntes = correntes;
+            fila.produzir(std::move(quadro));
+        }
+        fila.fechar();
+        render.join();
+    }
+
+    // Destaque do encontro, se houver
+    if (tempoEncontro >= 0) {
+        std::cout << "\n\033[1;31m";
+        std::cout << "      ╔══════════════════════════════════════════════╗\n";
+        std::cout << "      ║             ⚔ ENCONTRO DECISIVO ⚔           ║\n";
+        std::cout << "      ╚══════════════════════════════════════════════╝\n";
+        std::cout << "   » Tipo: " << tipoEncontro << "  •  Tempo: " << std::fixed << std::setprecision(2) << tempoEncontro << "\n";
+        if (!localEncontro.empty()) {
+            std::cout << "   » Local: " << localEncontro << "\n";
+        }
+        std::cout << "\033[0m\n";
+    }
+}
@@ -10,9 +10,15 @@
 
 #include "labirinto/Minotauro.h"
 #include "utils/Logger.h"
+#include "utils/Estatisticas.h"
+#include "utils/Memoria.h"
 #include "labirinto/Grafo.h"
 #include <limits> 
 #include <iostream>
+#include "estruturas/FibHeap.h"
+#include "estruturas/HeapPareamento.h"
+#include "estruturas/HeapQuaternario.h"
+#include "estruturas/HeapRadix.h"
 
 /// @brief Define um valor para representar a distância infinita, útil na inicialização de algoritmos de caminho mínimo.
 const int INF = std::numeric_limits<int>::max();
@@ -51,10 +57,11 @@ void Minotauro::lembrarCaminhos() {
     // Preenche as matrizes com as distâncias iniciais e os próximos passos
     for (int u = 0; u < n; ++u) {
         memoriaDistancias[u][u] = 0; // Distância para si mesmo é zero
-        const auto& vizinhos = labirinto.get_vizinhos(u); 
-        for (auto no = vizinhos.get_cabeca(); no != nullptr; no = no->prox) {
-            int v = no->dado.primeiro;
-            int peso = no->dado.segundo;
+        for (const auto& vizinho : labirinto.get_vizinhos(u)) {
+            int v = vizinho.primeiro;
+            int peso = vizinho.segundo;
+            // Corredores paralelos: vale o mais curto (como no Dijkstra do oráculo)
+            if (v == u || peso >= memoriaDistancias[u][v]) continue;
             memoriaDistancias[u][v] = peso;  // Distância direta entre u e v
             memoriaCaminho[u][v] = v;  // Próximo passo de u para v é v
         }
@@ -76,6 +83,179 @@ void Minotauro::lembrarCaminhos() {
     }
 }
 
+/**
+ * @brief Atualiza a memória após a mudança de um corredor.
+ * @details Encurtar ou abrir um corredor só pode diminuir distâncias (relaxamento);
+ * alongá-lo ou removê-lo só pode aumentá-las (reparo das salas afetadas). Cada
+ * caso toca apenas as linhas cujos caminhos mínimos passam, ou passariam, pelo
+ * corredor; as demais continuam válidas, inclusive os próximos passos, pois o
+ * primeiro passo de um caminho não afetado leva a uma sala cujo caminho restante
+ * também não foi afetado. Sem memória calculada, não há o que atualizar.
+ * @param u Um extremo do corredor.
+ * @param v O outro extremo do corredor.
+ * @param pesoAntigo O peso anterior (<= 0 se o corredor não existia).
+ * @param pesoNovo O novo peso (<= 0 se o corredor desabou).
+ * @return O número de linhas reparadas.
+ */
+int Minotauro::atualizarCorredor(int u, int v, int pesoAntigo, int pesoNovo) {
+    int n = memoriaNumeroDeSalas;
+    if (u < 0 || v < 0 || u >= n || v >= n || u == v) return 0;
+    if (memoriaDistancias.empty() || static_cast<int>(memoriaDistancias[0].size()) != n) return 0;
+
+    if (pesoAntigo > 0 && (pesoNovo <= 0 || pesoNovo > pesoAntigo)) {
+        using Item = std::pair<long long, int>;
+        switch (filaReparo) {
+            case FilaReparo::QUATERNARIO: return repararCorredor<HeapQuaternario<Item>>(u, v, pesoAntigo);
+            case FilaReparo::PAREAMENTO: return repararCorredor<HeapPareamento<Item>>(u, v, pesoAntigo);
+            case FilaReparo::RADIX: return repararCorredor<HeapRadix<Item>>(u, v, pesoAntigo);
+            case FilaReparo::FIB_HEAP: break;
+        }
+        return repararCorredor<FibHeap<Item>>(u, v, pesoAntigo);
+    }
+    if (pesoNovo > 0 && (pesoAntigo <= 0 || pesoNovo < pesoAntigo)) {
+        return relaxarCorredor(u, v, pesoNovo);
+    }
+    return 0;
+}
+
+/**
+ * @brief Relaxa a memória para um corredor u-v que ficou mais curto (ou se abriu).
+ * @details A nova distância de i a j é min(d[i][j], d[i][u] + w + d[v][j],
+ * d[i][v] + w + d[u][j]), com as distâncias anteriores à mudança. Como o grafo é
+ * não-direcionado, as colunas u e v são as linhas u e v, copiadas antes de
+ * qualquer escrita. Se d[i][u] + w não melhora d[i][v] (nem o simétrico), nenhuma
+ * sala da linha i melhora, e a linha é pulada sem varredura.
+ * @param u Um extremo do corredor.
+ * @param v O outro extremo do corredor.
+ * @param peso O novo peso do corredor.
+ * @return O número de linhas alteradas.
+ */
+int Minotauro::relaxarCorredor(int u, int v, int peso) {
+    int n = memoriaNumeroDeSalas;
+    const std::vector<int> du = memoriaDistancias[u];
+    const std::vector<int> dv = memoriaDistancias[v];
+    int linhas = 0;
+
+    for (int i = 0; i < n; ++i) {
+        long long iu = du[i], iv = dv[i];
+        bool viaUV = du[i] != INF && (dv[i] == INF || iu + peso < iv); // i ~> u -> v ~> j
+        bool viaVU = dv[i] != INF && (du[i] == INF || iv + peso < iu); // i ~> v -> u ~> j
+        if (!viaUV && !viaVU) continue;
+
+        auto& dist = memoriaDistancias[i];
+        auto& caminho = memoriaCaminho[i];
+        // Primeiro passo de i pelos dois sentidos do corredor (fixado antes das escritas)
+        int passoUV = (i == u) ? v : caminho[u];
+        int passoVU = (i == v) ? u : caminho[v];
+        for (int j = 0; j < n; ++j) {
+            if (viaUV && dv[j] != INF && iu + peso + dv[j] < dist[j]) {
+                dist[j] = static_cast<int>(iu + peso + dv[j]);
+                caminho[j] = passoUV;
+            }
+            if (viaVU && du[j] != INF && iv + peso + du[j] < dist[j]) {
+                dist[j] = static_cast<int>(iv + peso + du[j]);
+                caminho[j] = passoVU;
+            }
+        }
+        linhas++;
+    }
+    Logger::info(tempoMinotauro, "Minotauro reaprende o corredor {}-{} (peso {}): {} linha(s) da memória atualizadas.", Logger::LogSource::MINOTAURO, u, v, peso, linhas);
+    return linhas;
+}
+
+/**
+ * @brief Repara a memória para um corredor u-v que ficou mais longo (ou desabou).
+ * @details Para cada origem i, as salas afetadas são as que tinham algum caminho
+ * mínimo pelo corredor: d[i][u] + w + d[v][j] == d[i][j] (ou o simétrico). Uma
+ * origem sem caminho mínimo até u ou v pelo corredor não tem sala afetada. As
+ * afetadas recebem uma distância provisória pelos vizinhos não afetados e são
+ * finalizadas por um Dijkstra restrito a elas, que também recompõe o primeiro
+ * passo: herdado do vizinho, ou o próprio destino quando o vizinho é a origem.
+ * @tparam Fila A fila de prioridade do Dijkstra, escolhida por `setFilaReparo`. A mesma
+ * fila serve a todas as linhas: cada linha a esvazia antes da próxima.
+ * @param u Um extremo do corredor.
+ * @param v O outro extremo do corredor.
+ * @param pesoAntigo O peso do corredor antes da mudança.
+ * @return O número de linhas reparadas.
+ */
+template <typename Fila>
+int Minotauro::repararCorredor(int u, int v, int pesoAntigo) {
+    int n = memoriaNumeroDeSalas;
+    const std::vector<int> du = memoriaDistancias[u];
+    const std::vector<int> dv = memoriaDistancias[v];
+    std::vector<char> afetada(n, 0);
+    std::vector<int> afetadas;
+    using Item = std::pair<long long, int>; // (distância, sala)
+    Fila fila;
+    std::vector<typename Fila::Handle> naFila(n, Fila::NULO); // handle de cada sala ainda na fila
+    int linhas = 0;
+
+    for (int i = 0; i < n; ++i) {
+        if (du[i] == INF || dv[i] == INF) continue;
+        long long iu = du[i], iv = dv[i];
+        bool usaUV = iu + pesoAntigo == iv;
+        bool usaVU = iv + pesoAntigo == iu;
+        if (!usaUV && !usaVU) continue;
+
+        auto& dist = memoriaDistancias[i];
+        auto& caminho = memoriaCaminho[i];
+        afetadas.clear();
+        for (int j = 0; j < n; ++j) {
+            if (dist[j] == INF) continue;
+            if ((usaUV && dv[j] != INF && iu + pesoAntigo + dv[j] == dist[j]) ||
+                (usaVU && du[j] != INF && iv + pesoAntigo + du[j] == dist[j])) {
+                afetada[j] = 1;
+                afetadas.push_back(j);
+            }
+        }
+        for (int j : afetadas) {
+            dist[j] = INF;
+            caminho[j] = -1;
+        }
+
+        // Distâncias provisórias pela fronteira com as salas não afetadas
+        for (int j : afetadas) {
+            for (const auto& vizinho : labirinto.get_vizinhos(j)) {
+                int x = vizinho.primeiro;
+                if (x < 0 || x >= n || afetada[x] || dist[x] == INF) continue;
+                long long candidato = static_cast<long long>(dist[x]) + vizinho.segundo;
+                if (candidato < dist[j]) {
+                    dist[j] = static_cast<int>(candidato);
+                    caminho[j] = (x == i) ? j : caminho[x];
+                }
+            }
+            if (dist[j] != INF) {
+                naFila[j] = fila.inserir(Item{dist[j], j});
+                LAB_CONTAR(operacoesHeap);
+            }
+        }
+
+        // Dijkstra restrito às salas afetadas
+        while (!fila.ehVazio()) {
+            auto [d, j] = fila.extrairMin();
+            LAB_CONTAR(operacoesHeap);
+            naFila[j] = Fila::NULO;
+            for (const auto& vizinho : labirinto.get_vizinhos(j)) {
+                int y = vizinho.primeiro;
+                if (y < 0 || y >= n || !afetada[y]) continue;
+                long long candidato = d + vizinho.segundo;
+                if (candidato < dist[y]) {
+                    dist[y] = static_cast<int>(candidato);
+                    caminho[y] = caminho[j];
+                    if (naFila[y] != Fila::NULO) fila.diminuirChave(naFila[y], Item{candidato, y});
+                    else naFila[y] = fila.inserir(Item{candidato, y});
+                    LAB_CONTAR(operacoesHeap);
+                }
+            }
+        }
+
+        for (int j : afetadas) afetada[j] = 0;
+        linhas++;
+    }
+    Logger::info(tempoMinotauro, "Minotauro esquece o corredor {}-{} (peso anterior {}): {} linha(s) da memória reparadas.", Logger::LogSource::MINOTAURO, u, v, pesoAntigo, linhas);
+    return linhas;
+}
+
 /**
  * @brief Consulta a memória para encontrar o próximo passo em um caminho mínimo.
  * @param atual O vértice de origem.
@@ -83,7 +263,7 @@ void Minotauro::lembrarCaminhos() {
  * @return O primeiro vértice no caminho mais curto de 'atual' para 'dest'.
  * @retval -1 Se os índices forem inválidos.
  */
-int Minotauro::lembrarProxPasso(int atual, int dest){
+int Minotauro::lembrarProxPasso(int atual, int dest) const {
     // Verifica se os índices estão dentro dos limites
     if (atual < 0 || dest < 0 || atual >= memoriaNumeroDeSalas || dest >= memoriaNumeroDeSalas) {
     Logger::error(tempoMinotauro, "lembrarProxPasso: Indice fora do limite: atual={}, dest={}", Logger::LogSource::MINOTAURO, atual, dest);
@@ -102,7 +282,7 @@ int Minotauro::lembrarProxPasso(int atual, int dest){
  * @return A distância total (soma dos pesos) do caminho mais curto entre 'atual' e 'dest'.
  * @retval -1 Se os índices forem inválidos.
  */
-int Minotauro::lembrarDist(int atual, int dest){
+int Minotauro::lembrarDist(int atual, int dest) const {
     // Verifica se os índices estão dentro dos limites
     if (atual < 0 || dest < 0 || atual >= memoriaNumeroDeSalas || dest >= memoriaNumeroDeSalas) {
     Logger::error(tempoMinotauro, "lembrarDist: Indice fora do limite: atual={}, dest={}", Logger::LogSource::MINOTAURO, atual, dest);
@@ -138,3 +318,24 @@ int Minotauro::getPercepcao() const {
 int Minotauro::getPos() const {
     return pos;
 }
+
+/**
+ * @brief Soma a capacidade das duas matrizes de memória, linha a linha.
+ * @return Os bytes ocupados no heap.
+ */
+int64_t Minotauro::bytesAlocados() const {
+    int64_t total = bytesDeVetor(memoriaCaminho) + bytesDeVetor(memoriaDistancias);
+    for (const auto& linha : memoriaCaminho) total += bytesDeVetor(linha);
+    for (const auto& linha : memoriaDistancias) total += bytesDeVetor(linha);
+    return total;
+}
+
+/**
+ * @brief Estima os bytes das matrizes que `lembrarCaminhos` alocará.
+ * @param nV O número de salas.
+ * @return Os bytes estimados.
+ */
+int64_t Minotauro::estimarBytes(int nV) {
+    const int64_t n = nV;
+    return 2 * (n * static_cast<int64_t>(sizeof(std::vector<int>)) + n * n * static_cast<int64_t>(sizeof(int)));
+}
@@ -0,0 +1,262 @@
+/**
+ * @file Oraculo.cpp
+ * @author Thiago Nerton
+ * @brief Implementação do oráculo de distâncias (flag `--query`).
+ * @details Com Dijkstra, as consultas são agrupadas pela sala de origem: cada origem
+ * distinta tem uma única árvore de caminhos mínimos, calculada numa thread do pool e
+ * descartada depois de responder o seu grupo. As respostas são guardadas na posição
+ * de cada consulta e impressas no fim, na ordem do lote.
+ */
+
+#include "labirinto/Oraculo.h"
+#include "labirinto/Minotauro.h"
+#include "estruturas/HeapRadix.h"
+#include "utils/EscritorJson.h"
+#include "utils/PoolTrabalho.h"
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <sstream>
+#include <unordered_map>
+
+namespace {
+
+// Custos medidos com labirinto_bench em Release: minotauro/lembrarCaminhos (por V³) e
+// filas/radix (por sala, labirintos esparsos)
+constexpr double NS_FLOYD_POR_V3 = 1.2;
+constexpr double NS_DIJKSTRA_POR_SALA = 100.0;
+
+const char* nomeTipo(Oraculo::Tipo tipo) {
+    switch (tipo) {
+        case Oraculo::Tipo::DISTANCIA: return "dist";
+        case Oraculo::Tipo::PROXIMO_PASSO: return "passo";
+        case Oraculo::Tipo::RAIO: return "raio";
+    }
+    return "";
+}
+
+} // namespace
+
+/**
+ * @brief Cria o oráculo sobre o cenário de `base`.
+ */
+Oraculo::Oraculo(const Simulador& base) : base(base) {}
+
+/**
+ * @brief Converte `entrada`, `saida`, `covil` ou um número de sala.
+ */
+bool Oraculo::lerSala(const std::string& texto, int& sala) const {
+    if (texto == "entrada") sala = base.vEntr;
+    else if (texto == "saida") sala = base.labirinto.get_saida();
+    else if (texto == "covil") sala = base.posIniM;
+    else {
+        char* fim = nullptr;
+        const long valor = std::strtol(texto.c_str(), &fim, 10);
+        if (texto.empty() || *fim != '\0' || valor < 0 || valor >= base.nV) return false;
+        sala = static_cast<int>(valor);
+    }
+    return sala >= 0 && sala < base.nV;
+}
+
+/**
+ * @brief Lê e interpreta as consultas, uma por linha.
+ * @details Linhas vazias e comentários (de `#` ao fim da linha) não geram consultas,
+ * mas contam na numeração das linhas.
+ */
+std::vector<Oraculo::Consulta> Oraculo::lerConsultas(std::istream& entrada) const {
+    std::vector<Consulta> consultas;
+    std::string linha;
+    int numeroLinha = 0;
+    while (std::getline(entrada, linha)) {
+        ++numeroLinha;
+        std::stringstream campos(linha.substr(0, linha.find('#')));
+        std::vector<std::string> tokens;
+        std::string token;
+        while (campos >> token) tokens.push_back(token);
+        if (tokens.empty()) continue;
+
+        Consulta consulta;
+        consulta.linha = numeroLinha;
+        const std::string& comando = tokens[0];
+        if (comando == "dist" || comando == "passo") {
+            consulta.tipo = comando == "dist" ? Tipo::DISTANCIA : Tipo::PROXIMO_PASSO;
+            if (tokens.size() != 3) consulta.erro = "uso: " + comando + " A B";
+            else if (!lerSala(tokens[1], consulta.a)) consulta.erro = "sala inválida '" + tokens[1] + "'";
+            else if (!lerSala(tokens[2], consulta.b)) consulta.erro = "sala inválida '" + tokens[2] + "'";
+        } else if (comando == "raio") {
+            consulta.tipo = Tipo::RAIO;
+            long raio = -1;
+            char* fim = nullptr;
+            if (tokens.size() > 1) raio = std::strtol(tokens[1].c_str(), &fim, 10);
+            if (tokens.size() < 2 || tokens.size() > 3) consulta.erro = "uso: raio R [C]";
+            else if (*fim != '\0' || raio < 0 || raio >= Grafo::INFINITO) consulta.erro = "raio inválido '" + tokens[1] + "'";
+            else if (!lerSala(tokens.size() == 3 ? tokens[2] : "covil", consulta.a)) consulta.erro = "sala inválida '" + tokens[2] + "'";
+            consulta.b = static_cast<int>(std::max(0L, raio));
+        } else {
+            consulta.erro = "consulta desconhecida '" + comando + "' (use dist, passo ou raio)";
+        }
+        consultas.push_back(std::move(consulta));
+    }
+    return consultas;
+}
+
+/**
+ * @brief Atribui a cada consulta a origem da árvore que a responde.
+ * @details Primeiro as origens obrigatórias (`passo` e `raio`), depois as de `dist`,
+ * que reaproveitam um extremo já presente.
+ */
+std::vector<int> Oraculo::atribuirOrigens(const std::vector<Consulta>& consultas) const {
+    std::vector<int> origens(consultas.size(), -1);
+    std::vector<char> ehOrigem(static_cast<size_t>(base.nV), 0);
+    for (size_t i = 0; i < consultas.size(); ++i) {
+        const Consulta& c = consultas[i];
+        if (!c.erro.empty() || c.tipo == Tipo::DISTANCIA) continue;
+        origens[i] = c.tipo == Tipo::PROXIMO_PASSO ? c.b : c.a;
+        ehOrigem[origens[i]] = 1;
+    }
+    for (size_t i = 0; i < consultas.size(); ++i) {
+        const Consulta& c = consultas[i];
+        if (!c.erro.empty() || c.tipo != Tipo::DISTANCIA) continue;
+        origens[i] = !ehOrigem[c.a] && ehOrigem[c.b] ? c.b : c.a;
+        ehOrigem[origens[i]] = 1;
+    }
+    return origens;
+}
+
+/**
+ * @brief Compara o Floyd-Warshall (V³, numa thread) com uma árvore por origem distinta
+ * (V log V cada, repartidas entre as threads).
+ * @details O Floyd-Warshall só é candidato se as matrizes couberem no limite de memória.
+ */
+Oraculo::Estrategia Oraculo::escolher(const std::vector<Consulta>& consultas, int numThreads, long limiteMemoriaMiB) const {
+    const std::vector<int> origens = atribuirOrigens(consultas);
+    std::vector<int> distintas(origens);
+    std::sort(distintas.begin(), distintas.end());
+    distintas.erase(std::unique(distintas.begin(), distintas.end()), distintas.end());
+    const double numOrigens = static_cast<double>(std::count_if(distintas.begin(), distintas.end(), [](int o) { return o >= 0; }));
+    if (numOrigens == 0) return Estrategia::DIJKSTRA;
+
+    if (limiteMemoriaMiB > 0 && Minotauro::estimarBytes(base.nV) > (static_cast<int64_t>(limiteMemoriaMiB) << 20)) {
+        return Estrategia::DIJKSTRA;
+    }
+    const double v = static_cast<double>(base.nV);
+    const double threads = std::min(numOrigens, static_cast<double>(PoolTrabalho(numThreads).getNumThreads()));
+    const double custoMemoria = NS_FLOYD_POR_V3 * v * v * v;
+    const double custoDijkstra = NS_DIJKSTRA_POR_SALA * v * numOrigens / threads;
+    return custoMemoria < custoDijkstra ? Estrategia::MEMORIA : Estrategia::DIJKSTRA;
+}
+
+/**
+ * @brief Responde uma consulta com as distâncias de `origem` a todas as salas.
+ * @details Em `passo`, `origem` é o destino B: o próximo passo de A é o primeiro
+ * vizinho (na ordem do arquivo) que mantém A num caminho mínimo até B. As duas
+ * estratégias derivam o passo assim, então concordam mesmo com caminhos empatados.
+ */
+Oraculo::Resposta Oraculo::responderComDistancias(const Consulta& consulta, int origem, const std::vector<int>& dist) const {
+    Resposta resposta;
+    switch (consulta.tipo) {
+        case Tipo::DISTANCIA: {
+            const int d = dist[origem == consulta.a ? consulta.b : consulta.a];
+            resposta.valor = d == Grafo::INFINITO ? -1 : d;
+            break;
+        }
+        case Tipo::PROXIMO_PASSO: {
+            if (consulta.a == consulta.b) {
+                resposta.valor = consulta.a;
+                break;
+            }
+            if (dist[consulta.a] == Grafo::INFINITO) break;
+            const Grafo::Vizinhanca vizinhos = base.labirinto.vizinhanca(consulta.a);
+            for (int k = 0; k < vizinhos.grau; ++k) {
+                const int v = vizinhos.ids[k];
+                if (dist[v] != Grafo::INFINITO && static_cast<long long>(dist[v]) + vizinhos.pesos[k] == dist[consulta.a]) {
+                    resposta.valor = v;
+                    break;
+                }
+            }
+            break;
+        }
+        case Tipo::RAIO:
+            for (int sala = 0; sala < static_cast<int>(dist.size()); ++sala) {
+                if (dist[sala] <= consulta.b) resposta.salas.push_back(sala);
+            }
+            break;
+    }
+    return resposta;
+}
+
+/**
+ * @brief Responde o lote e imprime uma linha JSON por consulta.
+ * @details Com a memória, cada consulta lê uma linha das distâncias: a de A em `dist`
+ * e `raio`, a de B em `passo`, que percorre os vizinhos de A como com Dijkstra (o
+ * próximo passo do Floyd-Warshall pode ser outro, entre caminhos empatados); com
+ * Dijkstra, uma árvore por origem distinta, em paralelo.
+ */
+int Oraculo::responder(std::ostream& saida, const std::vector<Consulta>& consultas, Estrategia estrategia, int numThreads) const {
+    if (estrategia == Estrategia::AUTOMATICA) estrategia = escolher(consultas, numThreads, 0);
+    const std::vector<int> origens = atribuirOrigens(consultas);
+    std::vector<Resposta> respostas(consultas.size());
+
+    if (estrategia == Estrategia::MEMORIA) {
+        const std::unique_ptr<Minotauro> memoria = base.calcularMemoriaMinotauro();
+        for (size_t i = 0; i < consultas.size(); ++i) {
+            const Consulta& c = consultas[i];
+            if (!c.erro.empty()) continue;
+            const int origem = c.tipo == Tipo::PROXIMO_PASSO ? c.b : c.a;
+            respostas[i] = responderComDistancias(c, origem, memoria->lembrarDistancias(origem));
+        }
+    } else {
+        // Grupos de consultas por origem, na ordem da primeira aparição
+        std::unordered_map<int, int> grupoDaOrigem;
+        std::vector<int> origemDoGrupo;
+        std::vector<std::vector<size_t>> grupos;
+        for (size_t i = 0; i < consultas.size(); ++i) {
+            if (origens[i] < 0) continue;
+            const auto [it, nova] = grupoDaOrigem.emplace(origens[i], static_cast<int>(grupos.size()));
+            if (nova) {
+                origemDoGrupo.push_back(origens[i]);
+                grupos.emplace_back();
+            }
+            grupos[it->second].push_back(i);
+        }
+        std::vector<int> ordem(grupos.size());
+        for (size_t g = 0; g < grupos.size(); ++g) ordem[g] = static_cast<int>(g);
+        PoolTrabalho pool(numThreads);
+        pool.executar(ordem, [&](int g) {
+            const int origem = origemDoGrupo[g];
+            const std::vector<int> dist = base.labirinto.distanciasDe<HeapRadix<std::pair<int, int>>>(origem);
+            for (size_t i : grupos[g]) respostas[i] = responderComDistancias(consultas[i], origem, dist);
+        });
+    }
+
+    int invalidas = 0;
+    EscritorJson json(saida);
+    for (size_t i = 0; i < consultas.size(); ++i) {
+        const Consulta& c = consultas[i];
+        const Resposta& r = respostas[i];
+        json.abrirObjeto();
+        if (!c.erro.empty()) {
+            json.chave("linha").valor(c.linha);
+            json.chave("erro").valor(c.erro);
+            ++invalidas;
+        } else {
+            json.chave("consulta").valor(nomeTipo(c.tipo));
+            if (c.tipo == Tipo::RAIO) {
+                json.chave("centro").valor(c.a);
+                json.chave("r").valor(c.b);
+                json.chave("salas").abrirArray();
+                for (int sala : r.salas) json.valor(sala);
+                json.fecharArray();
+            } else {
+                json.chave("de").valor(c.a);
+                json.chave("para").valor(c.b);
+                json.chave(nomeTipo(c.tipo));
+                if (r.valor < 0) json.nulo();
+                else json.valor(r.valor);
+            }
+        }
+        json.fecharObjeto();
+        json.bruto("\n");
+    }
+    return invalidas;
+}
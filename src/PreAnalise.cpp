@@ -0,0 +1,67 @@
+/**
+ * @file PreAnalise.cpp
+ * @author Thiago Nerton
+ * @brief Implementação da pré-análise estática do cenário.
+ * @details Este arquivo contém a análise feita logo após `carregarArquivo`, que
+ * identifica cenários decididos antes do primeiro evento: Minotauro em outro
+ * componente conexo, saída fora do alcance dos kits ou prisioneiro sem comida.
+ */
+
+#include "labirinto/Simulador.h"
+#include "utils/Logger.h"
+
+/**
+ * @brief Analisa o cenário carregado sem executar a simulação.
+ * @details Um encontro (em sala ou em corredor) exige que os dois agentes ocupem
+ * salas do mesmo componente conexo; caso contrário o desfecho depende apenas da
+ * trajetória determinística do prisioneiro, que não varia com a seed nem com a
+ * chance de batalha. Como `verificaEstados` testa a fome antes da saída, a fuga
+ * exige chegar à saída com pelo menos um kit sobrando (`distSaida < kits`).
+ * Se o cenário tiver corredores dinâmicos, só o caso sem kits é garantido.
+ * @return Uma struct `PreAnalise` com componentes, alcance e desfechos garantidos.
+ */
+Simulador::PreAnalise Simulador::preAnalisar() const {
+    PreAnalise analise;
+    std::vector<int> rotulo;
+    analise.numComponentes = labirinto.componentes(rotulo);
+
+    const int vSaida = labirinto.get_saida();
+    auto valida = [&](int v) { return v >= 0 && v < nV; };
+    if (!valida(vEntr)) {
+        return analise; // cenário inválido: nada pode ser garantido
+    }
+
+    std::vector<int> dist = labirinto.distanciasDe(vEntr);
+    for (int v = 0; v < nV; ++v) {
+        if (dist[v] != Grafo::INFINITO && dist[v] <= kitsDeComida) {
+            analise.salasAlcancaveis++;
+        }
+    }
+    if (valida(vSaida) && dist[vSaida] != Grafo::INFINITO) {
+        analise.distSaida = dist[vSaida];
+    }
+
+    // Sem kits o prisioneiro morre de fome no primeiro evento, antes de qualquer encontro
+    if (kitsDeComida <= 0) {
+        analise.encontroPossivel = false;
+        analise.fugaPossivel = false;
+        return analise;
+    }
+
+    // Com corredores dinâmicos, componentes e distâncias iniciais não garantem nada
+    if (temCorredoresDinamicos()) {
+        Logger::info(0.0, "Pré-análise: labirinto com {} mudança(s) de corredor; nenhum desfecho garantido.", Logger::LogSource::OUTRO, mudancasCorredores.size());
+        return analise;
+    }
+
+    analise.fugaPossivel = analise.distSaida >= 0 && analise.distSaida < kitsDeComida;
+    if (valida(posIniM)) {
+        analise.encontroPossivel = rotulo[posIniM] == rotulo[vEntr];
+    }
+
+    Logger::info(0.0, "Pré-análise: {} componente(s), distância até a saída {}, encontro {}, fuga {}.", Logger::LogSource::OUTRO,
+                 analise.numComponentes, analise.distSaida,
+                 analise.encontroPossivel ? "possível" : "impossível",
+                 analise.fugaPossivel ? "possível" : "impossível");
+    return analise;
+}
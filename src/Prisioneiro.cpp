@@ -9,9 +9,16 @@
 
 #include "labirinto/Prisioneiro.h"
 #include "utils/Logger.h"
+#include "utils/Estatisticas.h"
 #include "estruturas/Novelo.h"
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 /**
  * @brief Verifica se um vértice já foi visitado pelo prisioneiro.
@@ -19,7 +26,7 @@
  * @return `true` se o vértice já foi visitado, `false` caso contrário.
  */
 bool Prisioneiro::foiVisitado(int vertice) const {
-    return vertice >= 0 && vertice < (int)visitados.size() ? visitados[vertice] : false;
+    return visitados.contem(vertice);
 }
 
 /**
@@ -29,14 +36,56 @@ bool Prisioneiro::foiVisitado(int vertice) const {
  * rastro do novelo de lã.
  * @param salaInicial O vértice onde o prisioneiro inicia.
  * @param kitsDeComida A quantidade inicial de kits de comida.
+ * @param numSalas O número de salas do labirinto; o mapa de visitados tem um bit por sala.
+ * @param politica A política de exploração usada por `mover`.
+ * @param seed A semente do gerador da política aleatória.
+ * @param registro O que é gravado durante a jornada.
  */
-Prisioneiro::Prisioneiro(int salaInicial, int kitsDeComida) {
+Prisioneiro::Prisioneiro(int salaInicial, int kitsDeComida, int numSalas, PoliticaExploracao politica, unsigned int seed,
+                         NivelRegistro registro)
+    : registro(registro), visitados(numSalas), cursorVizinho(std::max(0, numSalas), 0),
+      geracaoCursor(std::max(0, numSalas), 0), politica(politica), gerador(seed) {
     pos = salaInicial;
     this->kitsDeComida = kitsDeComida;
-    visitados.resize(TamanhoDoNovelo::tamanhoNovelo, false);
-    visitados[pos] = true;
+    visitados.marcar(pos);
 
-    caminho.push_back(pos);
+    if (registro == NivelRegistro::COMPLETO) {
+        // Cada sala é visitada no máximo duas vezes por aresta da árvore da busca
+        caminho.reservar(2 * static_cast<size_t>(std::max(1, numSalas)));
+        caminho.adicionar(pos);
+    }
+    // A profundidade da busca nunca passa do número de salas
+    novelo.reservar(numSalas);
+    novelo.criarRastro({pos, 0});
+}
+
+/**
+ * @brief Recomeça a jornada no mesmo labirinto, reaproveitando as estruturas alocadas.
+ * @details O estado final é o de `Prisioneiro(posInicial, supDias, getNumSalas(),
+ * politica, seed, registro)`: o mapa de visitados é zerado palavra a palavra, os
+ * cursores de vizinhança mudam de geração e o novelo e o histórico são esvaziados
+ * sem devolver a capacidade.
+ */
+void Prisioneiro::reiniciar(int posInicial, int supDias, PoliticaExploracao politica, unsigned int seed,
+                            NivelRegistro registro) {
+    this->registro = registro;
+    this->politica = politica;
+    gerador.seed(seed);
+    pos = posInicial;
+    kitsDeComida = supDias;
+    custoVolta = 0;
+    numMovimentos = 0;
+    historico.clear();
+    visitados.limpar();
+    visitados.marcar(pos);
+    invalidarCursores();
+
+    caminho.limpar();
+    if (registro == NivelRegistro::COMPLETO) {
+        caminho.reservar(2 * static_cast<size_t>(std::max(1, getNumSalas())));
+        caminho.adicionar(pos);
+    }
+    novelo.limpar();
     novelo.criarRastro({pos, 0});
 }
 
@@ -50,60 +99,206 @@ int Prisioneiro::getPos() const {
 
 /**
  * @brief Adiciona um evento ao histórico de acontecimentos do prisioneiro.
- * @param tipo Categoria do evento (ex: "BACKTRACK").
- * @param descricao Uma breve descrição do que aconteceu.
+ * @details O registro é um POD de 12 bytes; a descrição vem de `descricao(tipo)`.
+ * @param tipo Categoria do evento (ex: `TipoAcontecimento::BACKTRACK`).
  * @param posicao A sala onde o evento ocorreu.
  * @param tempo O custo em tempo/comida associado ao evento.
  */
-void Prisioneiro::registrarAcontecimento(const std::string& tipo, const std::string& descricao, int posicao, int tempo) {
-    HistoricoPrisioneiro h{tipo, descricao, posicao, tempo};
-    historico.push_back(h);
+void Prisioneiro::registrarAcontecimento(TipoAcontecimento tipo, int posicao, int tempo) {
+    if (registro == NivelRegistro::DESLIGADO) return;
+    historico.push_back(HistoricoPrisioneiro{tipo, posicao, tempo});
+}
+
+/**
+ * @brief Descrição textual de um tipo de acontecimento.
+ * @param tipo O tipo do acontecimento.
+ * @return Um texto estático com a descrição.
+ */
+const char* Prisioneiro::descricao(TipoAcontecimento tipo) {
+    switch (tipo) {
+        case TipoAcontecimento::BACKTRACK: return "Voltou para sala anterior";
+        case TipoAcontecimento::PRESO: return "Não pôde avançar nem voltar";
+    }
+    return "";
 }
 
 /**
  * @brief Obtém o caminho percorrido pelo prisioneiro até o momento.
- * @return Uma referência constante para o vetor de inteiros representando a sequência de vértices visitados.
+ * @return Uma referência constante para a sequência de vértices visitados.
  */
-const std::vector<int>& Prisioneiro::getCaminho() const {
+const CaminhoCompacto& Prisioneiro::getCaminho() const {
     return caminho;
 }
 
+/**
+ * @brief Candidatos entre os vizinhos [i, i + LARGURA_SIMD) da sala atual.
+ * @details Os pesos são comparados com `custoMaximo` numa instrução. Com AVX2, as
+ * palavras de 32 bits do mapa de visitados que contêm cada vizinho são coletadas
+ * (gather) e o bit de cada um é isolado por deslocamento, também de uma vez; com
+ * SSE2 (sem gather) os bits de visitado são lidos um a um, sem desvios. Ids fora de
+ * [0, salas) nunca estão visitados, como em `MapaDeBits::contem`. As leituras podem
+ * passar do fim da sala (entram na próxima ou no preenchimento do CSR), mas esses
+ * bits são descartados.
+ * @param vizinhos A vizinhança compacta da sala atual.
+ * @param i O primeiro vizinho examinado.
+ * @param custoMaximo O maior peso aceito.
+ * @return A máscara: bit k ligado se o vizinho i + k é candidato.
+ */
+unsigned Prisioneiro::mascaraCandidatos(const Grafo::Vizinhanca& vizinhos, int i, int custoMaximo) const {
+    unsigned mascara;
+#if defined(__AVX2__)
+    const __m256i ids = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(vizinhos.ids + i));
+    const __m256i pesos = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(vizinhos.pesos + i));
+    const __m256i caros = _mm256_cmpgt_epi32(pesos, _mm256_set1_epi32(custoMaximo));
+    const __m256i validos = _mm256_and_si256(_mm256_cmpgt_epi32(ids, _mm256_set1_epi32(-1)),
+                                             _mm256_cmpgt_epi32(_mm256_set1_epi32(visitados.tamanho()), ids));
+    // Palavra de 32 bits id / 32 (little-endian: metade da palavra de 64 bits), bit id % 32
+    const __m256i palavras = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), reinterpret_cast<const int*>(visitados.dados()),
+                                                         _mm256_srli_epi32(ids, 5), validos, 4);
+    const __m256i uns = _mm256_set1_epi32(1);
+    const __m256i bits = _mm256_and_si256(_mm256_srlv_epi32(palavras, _mm256_and_si256(ids, _mm256_set1_epi32(31))), uns);
+    const __m256i descartados = _mm256_or_si256(caros, _mm256_cmpeq_epi32(bits, uns));
+    mascara = ~static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(descartados))) & 0xFFu;
+#elif defined(__SSE2__)
+    const __m128i pesos = _mm_loadu_si128(reinterpret_cast<const __m128i*>(vizinhos.pesos + i));
+    const __m128i caros = _mm_cmpgt_epi32(pesos, _mm_set1_epi32(custoMaximo));
+    unsigned visitadosNoBloco = 0;
+    for (int k = 0; k < LARGURA_SIMD; ++k) {
+        visitadosNoBloco |= static_cast<unsigned>(visitados.contem(vizinhos.ids[i + k])) << k;
+    }
+    mascara = ~(static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(caros))) | visitadosNoBloco) & 0xFu;
+#else
+    mascara = 0;
+    for (int k = 0; k < LARGURA_SIMD; ++k) {
+        if (!visitados.contem(vizinhos.ids[i + k]) && vizinhos.pesos[i + k] <= custoMaximo) mascara |= 1u << k;
+    }
+#endif
+    const int restantes = vizinhos.grau - i;
+    if (restantes < LARGURA_SIMD) mascara &= (1u << restantes) - 1;
+    return mascara;
+}
+
+/**
+ * @brief Escolhe o próximo vizinho segundo a política `P`.
+ * @details Um vizinho é descartado se já foi visitado ou se custa mais do que a
+ * política permite com os kits atuais. Como visitados só crescem e kits só
+ * diminuem, um vizinho descartado nunca volta a ser candidato: a varredura de
+ * cada sala começa no seu cursor, que avança sobre o prefixo descartado e para no
+ * primeiro candidato. Na DFS o candidato escolhido é esse primeiro, então cada
+ * corredor é examinado um número constante de vezes na simulação inteira (O(E)
+ * amortizado) e a ordem é a mesma de uma varredura completa. As demais políticas
+ * comparam os candidatos restantes da sala, em O(grau) por chegada. As varreduras
+ * examinam LARGURA_SIMD vizinhos por vez (`mascaraCandidatos`).
+ * @tparam P A política de exploração.
+ * @param vizinhos A vizinhança compacta da sala atual.
+ * @return O índice do vizinho escolhido, ou -1 se não houver candidato.
+ */
+template <PoliticaExploracao P>
+int Prisioneiro::escolherVizinho(const Grafo::Vizinhanca& vizinhos) {
+    // A política consciente só atravessa um corredor de peso w se, depois dele, ainda
+    // puder desenrolar o novelo inteiro: kits - w >= custoVolta + w
+    const int custoMaximo = (P == PoliticaExploracao::CONSCIENTE_DA_COMIDA)
+        ? (kitsDeComida - custoVolta) / 2 : kitsDeComida;
+    const int grau = vizinhos.grau;
+
+    const int sala = pos;
+    const bool temCursor = sala >= 0 && sala < static_cast<int>(cursorVizinho.size());
+    int primeiro = (temCursor && geracaoCursor[sala] == geracaoAtual) ? cursorVizinho[sala] : 0;
+    // Caso comum na DFS: o vizinho do cursor já serve, sem montar a máscara de um bloco
+    if (primeiro < grau && (foiVisitado(vizinhos.ids[primeiro]) || vizinhos.pesos[primeiro] > custoMaximo)) {
+        int i = primeiro + 1;
+        primeiro = grau;
+        for (; i < grau; i += LARGURA_SIMD) {
+            const unsigned mascara = mascaraCandidatos(vizinhos, i, custoMaximo);
+            if (mascara != 0) {
+                primeiro = i + __builtin_ctz(mascara);
+                break;
+            }
+        }
+    }
+    if (temCursor) {
+        // Na DFS o primeiro candidato é o escolhido e estará visitado na volta
+        bool escolhidoAgora = P == PoliticaExploracao::DFS || P == PoliticaExploracao::CONSCIENTE_DA_COMIDA;
+        cursorVizinho[sala] = (escolhidoAgora && primeiro < grau) ? primeiro + 1 : primeiro;
+        geracaoCursor[sala] = geracaoAtual;
+    }
+    if (primeiro >= grau) {
+        return -1;
+    }
+
+    if constexpr (P == PoliticaExploracao::ARESTA_MAIS_BARATA) {
+        int melhor = primeiro;
+        for (int i = primeiro; i < grau; i += LARGURA_SIMD) {
+            for (unsigned m = mascaraCandidatos(vizinhos, i, custoMaximo); m != 0; m &= m - 1) {
+                const int k = i + __builtin_ctz(m);
+                if (vizinhos.pesos[k] < vizinhos.pesos[melhor]) melhor = k;
+            }
+        }
+        return melhor;
+    } else if constexpr (P == PoliticaExploracao::ALEATORIA) {
+        int numCandidatos = 0;
+        for (int i = primeiro; i < grau; i += LARGURA_SIMD) {
+            numCandidatos += __builtin_popcount(mascaraCandidatos(vizinhos, i, custoMaximo));
+        }
+        std::uniform_int_distribution<int> dist(0, numCandidatos - 1);
+        int alvo = dist(gerador);
+        for (int i = primeiro; i < grau; i += LARGURA_SIMD) {
+            unsigned m = mascaraCandidatos(vizinhos, i, custoMaximo);
+            const int n = __builtin_popcount(m);
+            if (alvo >= n) {
+                alvo -= n;
+                continue;
+            }
+            while (alvo-- > 0) m &= m - 1;
+            return i + __builtin_ctz(m);
+        }
+        return primeiro; // inalcançável
+    } else {
+        return primeiro;
+    }
+}
+
 /**
  * @brief Executa a lógica de movimento do prisioneiro para o próximo turno.
- * @details Prioriza mover-se para uma sala adjacente não visitada. Se todas as
- * salas vizinhas já foram visitadas, tenta realizar o backtracking com `voltarAtras`.
+ * @details Escolhe uma sala adjacente não visitada segundo a política de
+ * exploração. Se nenhuma servir, tenta realizar o backtracking com `voltarAtras`.
  * O movimento consome kits de comida equivalentes ao peso da aresta.
- * @param vizinhos A lista de adjacências do vértice atual do prisioneiro.
+ * @param vizinhos A vizinhança compacta do vértice atual do prisioneiro.
  * @return O custo (peso da aresta) do movimento realizado. Retorna 0 se nenhum movimento for possível.
  */
-int Prisioneiro::mover(const listaAdj<MeuPair<int, int>>& vizinhos) {
-    auto no_vizinho = vizinhos.get_cabeca();
-
+int Prisioneiro::mover(const Grafo::Vizinhanca& vizinhos) {
     if (kitsDeComida <= 0) {
         return 0;
     }
 
-    while (no_vizinho != nullptr)
-    {
-        int proximo_vertice = no_vizinho->dado.primeiro;
-        int peso_aresta = no_vizinho->dado.segundo;
+    int escolhido = -1;
+    switch (politica) {
+        case PoliticaExploracao::DFS:
+            escolhido = escolherVizinho<PoliticaExploracao::DFS>(vizinhos);
+            break;
+        case PoliticaExploracao::ARESTA_MAIS_BARATA:
+            escolhido = escolherVizinho<PoliticaExploracao::ARESTA_MAIS_BARATA>(vizinhos);
+            break;
+        case PoliticaExploracao::ALEATORIA:
+            escolhido = escolherVizinho<PoliticaExploracao::ALEATORIA>(vizinhos);
+            break;
+        case PoliticaExploracao::CONSCIENTE_DA_COMIDA:
+            escolhido = escolherVizinho<PoliticaExploracao::CONSCIENTE_DA_COMIDA>(vizinhos);
+            break;
+    }
 
-        if (!foiVisitado(proximo_vertice)) {
-            if (kitsDeComida < peso_aresta) {
-                no_vizinho = no_vizinho->prox;
-                continue;
-            }
-            novelo.criarRastro({pos, peso_aresta});
-            pos = proximo_vertice;
-            visitados[pos] = true;
-            caminho.push_back(pos);
-            kitsDeComida -= peso_aresta; 
-            return peso_aresta;
-        }
-        no_vizinho = no_vizinho->prox;
+    if (escolhido >= 0) {
+        int peso_aresta = vizinhos.pesos[escolhido];
+        novelo.criarRastro({pos, peso_aresta});
+        custoVolta += peso_aresta;
+        pos = vizinhos.ids[escolhido];
+        visitados.marcar(pos);
+        registrarPasso();
+        kitsDeComida -= peso_aresta;
+        return peso_aresta;
     }
 
-    int peso_volta = voltarAtras();
+    int peso_volta = voltarAtras(vizinhos);
     return peso_volta;
 }
 
@@ -123,30 +318,52 @@ Prisioneiro::~Prisioneiro() {
 
 /**
  * @brief Realiza o movimento de backtracking.
- * @details Usa o "novelo de lã" para retornar à sala anterior de onde veio.
- * Este movimento também consome a mesma quantidade de comida que o caminho de ida.
+ * @details Usa o "novelo de lã" para retornar à sala anterior de onde veio. O
+ * corredor de volta é o atual, não o da ida: se mudou de peso, a volta custa o
+ * peso novo; se desabou, a sala anterior ficou inalcançável pelo fio e a sala atual
+ * vira um beco (o rastro é mantido, caso o corredor se reabra).
+ * @param vizinhos A vizinhança compacta da sala atual.
  * @return O custo do movimento de retorno (peso da aresta). Retorna 0 se o backtracking não for possível.
  */
-int Prisioneiro::voltarAtras(){
+int Prisioneiro::voltarAtras(const Grafo::Vizinhanca& vizinhos){
     // Se todos os vizinhos já foram visitados, faz backtracking
     if (!novelo.nenhumRastro()) {
         MeuPair<int, int> rastroAnterior = novelo.topo();
+        // O primeiro rastro (peso 0) é a própria sala inicial, sem corredor
+        if (rastroAnterior.primeiro != pos) {
+            int pesoAtual = -1;
+            for (int k = 0; k < vizinhos.grau; ++k) {
+                if (vizinhos.ids[k] == rastroAnterior.primeiro && (pesoAtual < 0 || vizinhos.pesos[k] < pesoAtual)) {
+                    pesoAtual = vizinhos.pesos[k];
+                }
+            }
+            if (pesoAtual < 0) {
+                Logger::info(tempoPrisioneiro, "Não pode fazer backtracking para {} - Motivo: o corredor desabou.", Logger::LogSource::PRISIONEIRO, rastroAnterior.primeiro);
+                registrarAcontecimento(TipoAcontecimento::PRESO, pos, 0);
+                return 0;
+            }
+            rastroAnterior.segundo = pesoAtual;
+        }
         // Verifica se há comida para voltar
         if (kitsDeComida < rastroAnterior.segundo) {
             Logger::info(tempoPrisioneiro, "Não pode fazer backtracking para {} (peso: {}, kits restantes: {}) - Motivo: kits insuficientes.", Logger::LogSource::PRISIONEIRO, rastroAnterior.primeiro, rastroAnterior.segundo, kitsDeComida);
+            registrarAcontecimento(TipoAcontecimento::PRESO, pos, 0);
             return 0;
         }
         // Executa o backtracking
+        custoVolta -= novelo.topo().segundo;
         novelo.puxarRastro();
         int vertice_volta = rastroAnterior.primeiro;
         pos = vertice_volta;
-        caminho.push_back(pos);
+        registrarPasso();
         kitsDeComida -= rastroAnterior.segundo; // Consome kits de comida
         Logger::info(tempoPrisioneiro, "Escolha: backtracking para {} (peso: {}, kits restantes: {}) - Motivo: todos vizinhos visitados, rastro disponível e kits suficientes.", Logger::LogSource::PRISIONEIRO, pos, rastroAnterior.segundo, kitsDeComida);
-        registrarAcontecimento("BACKTRACK", "Voltou para sala anterior", pos, rastroAnterior.segundo);
+        registrarAcontecimento(TipoAcontecimento::BACKTRACK, pos, rastroAnterior.segundo);
+        LAB_CONTAR(backtracks);
         return rastroAnterior.segundo;
     }
     // Caso extremo: sem vizinhos e sem rastro
     Logger::warning(tempoPrisioneiro, "Prisioneiro está engasgado, sem vizinhos e sem rastro!", Logger::LogSource::PRISIONEIRO);
+    registrarAcontecimento(TipoAcontecimento::PRESO, pos, 0);
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,99 @@
+/**
+ * @file SaidaJson.cpp
+ * @author Thiago Nerton
+ * @brief Implementação da escrita de resultados em JSON.
+ */
+
+#include "labirinto/SaidaJson.h"
+#include "utils/EscritorJson.h"
+
+/**
+ * @brief Escreve uma string como literal JSON (entre aspas, com escapes).
+ */
+void escreverStringJson(std::ostream& saida, const std::string& texto) {
+    saida << '"';
+    escaparJson(texto, [&](const char* dados, size_t n) { saida.write(dados, static_cast<std::streamsize>(n)); });
+    saida << '"';
+}
+
+/// @brief O nome de um nível de registro, como em `--registro`.
+static const char* nomeNivelRegistro(NivelRegistro nivel) {
+    switch (nivel) {
+        case NivelRegistro::DESLIGADO: return "desligado";
+        case NivelRegistro::RESUMO: return "resumo";
+        case NivelRegistro::COMPLETO: break;
+    }
+    return "completo";
+}
+
+/**
+ * @brief Imprime o resultado em JSON.
+ * @details Com `linhaUnica`, o objeto ocupa uma linha (JSON Lines); senão, um membro por
+ * linha. Os arrays de `completo` vêm por último e são escritos elemento a elemento.
+ */
+void imprimirJson(std::ostream& saida, const Simulador::ResultadoSimulacao& resultado, const Simulador::PreAnalise* analise,
+                  bool linhaUnica, const Estatisticas* estatisticas, const ContabilidadeMemoria* memoria,
+                  const std::string& camposIniciais, bool completo) {
+    const bool encontrou = resultado.tempoEncontro >= 0;
+    EscritorJson json(saida, !linhaUnica);
+    json.abrirObjeto();
+    json.membros(camposIniciais);
+    json.chave("sobreviveu").valor(resultado.prisioneiroSobreviveu);
+    json.chave("tempo").valor(resultado.diasSobrevividos);
+    json.chave("tempoReal").valor(resultado.tempoReal);
+    json.chave("kits").valor(resultado.kitsRestantes);
+    json.chave("posP").valor(resultado.posFinalP);
+    json.chave("posM").valor(resultado.posFinalM);
+    json.chave("minotauroVivo").valor(resultado.minotauroVivo);
+    json.chave("encontro").abrirObjeto();
+    json.chave("ok").valor(encontrou);
+    json.chave("tipo").valor(encontrou ? resultado.tipoEncontro : std::string());
+    json.chave("t").valor(encontrou ? resultado.tempoEncontro : -1.0);
+    json.fecharObjeto();
+    if (analise) {
+        json.chave("preAnalise").abrirObjeto();
+        json.chave("encontroPossivel").valor(analise->encontroPossivel);
+        json.chave("fugaPossivel").valor(analise->fugaPossivel);
+        json.chave("deterministico").valor(analise->deterministico());
+        json.chave("distSaida").valor(analise->distSaida);
+        json.chave("salasAlcancaveis").valor(analise->salasAlcancaveis);
+        json.chave("componentes").valor(analise->numComponentes);
+        json.fecharObjeto();
+    }
+    if (estatisticas) {
+        json.chave("estatisticas");
+        estatisticas->escreverJson(json);
+    }
+    if (memoria) {
+        json.chave("memoria");
+        memoria->escreverJson(json);
+    }
+    if (completo) {
+        json.chave("motivoFim").valor(resultado.motivoFim);
+        // Abaixo do registro completo não há rastros nem linha do tempo: os arrays são
+        // omitidos (em vez de vazios) e `registro` diz por quê
+        json.chave("registro").valor(nomeNivelRegistro(resultado.registro));
+    }
+    if (completo && resultado.registro == NivelRegistro::COMPLETO) {
+        json.chave("caminhoP").abrirArray();
+        resultado.caminhoP.paraCada([&](int sala) { json.valor(sala); });
+        json.fecharArray();
+        json.chave("caminhoM").abrirArray();
+        for (int sala : resultado.caminhoM) json.valor(sala);
+        json.fecharArray();
+        json.chave("eventos").abrirArray();
+        for (const Logger::EventoMovimento& evento : resultado.eventos) {
+            json.abrirObjeto();
+            json.chave("agente").valor(evento.agente);
+            json.chave("inicio").valor(evento.tempoInicio);
+            json.chave("fim").valor(evento.tempoFim);
+            json.chave("origem").valor(evento.origem);
+            json.chave("destino").valor(evento.destino);
+            json.chave("peso").valor(evento.peso);
+            json.fecharObjeto();
+        }
+        json.fecharArray();
+    }
+    json.fecharObjeto();
+    json.bruto("\n");
+}
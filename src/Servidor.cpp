@@ -0,0 +1,428 @@
+/**
+ * @file Servidor.cpp
+ * @author Thiago Nerton
+ * @brief Implementação do modo de consultas persistente (`--serve`).
+ * @details Uma thread de entrada (a chamadora) lê os pedidos, do fluxo ou das conexões
+ * do socket (multiplexadas com `poll`), e os põe numa fila; as threads de atendimento
+ * os respondem. Sem corredores dinâmicos, cada pedido roda uma pista de `SimuladorLote`
+ * sobre a memória do Minotauro em cache, que é só consultada; assim pedidos do mesmo
+ * cenário rodam em paralelo e um pedido em cache não refaz carga nem Floyd-Warshall.
+ */
+
+#include "labirinto/Servidor.h"
+#include "labirinto/SaidaJson.h"
+#include "labirinto/SimuladorLote.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#define LABIRINTO_SOCKET_UNIX 1
+#endif
+
+namespace {
+
+/**
+ * @struct ValorJson
+ * @brief Um valor de um pedido: o texto JSON original e, para strings, o texto decodificado.
+ */
+struct ValorJson {
+    std::string bruto; // como aparece no pedido (devolvido no `id`)
+    std::string texto; // strings decodificadas; números e literais iguais a `bruto`
+    bool ehTexto = false;
+};
+
+// Lê um objeto JSON plano (valores string, número, true, false ou null). Objetos e
+// arrays aninhados não são aceitos: nenhum campo de pedido precisa deles.
+bool lerObjetoJson(const std::string& linha, std::map<std::string, ValorJson>& campos) {
+    size_t i = 0;
+    auto pularEspacos = [&] { while (i < linha.size() && std::isspace(static_cast<unsigned char>(linha[i]))) i++; };
+    auto lerTexto = [&](std::string& texto) {
+        if (i >= linha.size() || linha[i] != '"') return false;
+        for (i++; i < linha.size() && linha[i] != '"'; i++) {
+            if (linha[i] != '\\') { texto += linha[i]; continue; }
+            if (++i >= linha.size()) return false;
+            switch (linha[i]) {
+                case 'n': texto += '\n'; break;
+                case 't': texto += '\t'; break;
+                case 'r': texto += '\r'; break;
+                case 'b': texto += '\b'; break;
+                case 'f': texto += '\f'; break;
+                case 'u': {
+                    // Só o plano ASCII é decodificado; os demais pontos de código viram '?'
+                    if (i + 4 >= linha.size()) return false;
+                    const long codigo = std::strtol(linha.substr(i + 1, 4).c_str(), nullptr, 16);
+                    texto += codigo < 0x80 ? static_cast<char>(codigo) : '?';
+                    i += 4;
+                    break;
+                }
+                default: texto += linha[i]; // \" \\ \/
+            }
+        }
+        if (i >= linha.size()) return false;
+        i++; // aspas finais
+        return true;
+    };
+
+    pularEspacos();
+    if (i >= linha.size() || linha[i++] != '{') return false;
+    pularEspacos();
+    if (i < linha.size() && linha[i] == '}') return true;
+    while (true) {
+        std::string chave;
+        pularEspacos();
+        if (!lerTexto(chave)) return false;
+        pularEspacos();
+        if (i >= linha.size() || linha[i++] != ':') return false;
+        pularEspacos();
+        ValorJson valor;
+        const size_t inicio = i;
+        if (i < linha.size() && linha[i] == '"') {
+            if (!lerTexto(valor.texto)) return false;
+            valor.ehTexto = true;
+        } else {
+            while (i < linha.size() && linha[i] != ',' && linha[i] != '}' && !std::isspace(static_cast<unsigned char>(linha[i]))) i++;
+            valor.texto = linha.substr(inicio, i - inicio);
+            if (valor.texto.empty() || valor.texto[0] == '{' || valor.texto[0] == '[') return false;
+        }
+        valor.bruto = linha.substr(inicio, i - inicio);
+        campos[chave] = std::move(valor);
+        pularEspacos();
+        if (i < linha.size() && linha[i] == ',') { i++; continue; }
+        if (i < linha.size() && linha[i] == '}') return true;
+        return false;
+    }
+}
+
+// Lê um inteiro de um campo numérico; `false` se o campo não for só o número
+bool lerInteiro(const ValorJson& valor, long long& numero) {
+    if (valor.ehTexto || valor.texto.empty()) return false;
+    char* fim = nullptr;
+    numero = std::strtoll(valor.texto.c_str(), &fim, 10);
+    return *fim == '\0';
+}
+
+// FNV-1a de 64 bits: chave do cache (o conteúdo é comparado no acerto)
+uint64_t hashConteudo(const std::string& conteudo) {
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : conteudo) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// Resposta de erro, com o `id` do pedido quando houver
+std::string respostaErro(const std::string& campoId, const std::string& mensagem) {
+    std::ostringstream resposta;
+    resposta << '{';
+    if (!campoId.empty()) resposta << campoId << ", ";
+    resposta << "\"erro\": ";
+    escreverStringJson(resposta, mensagem);
+    resposta << "}\n";
+    return resposta.str();
+}
+
+} // namespace
+
+/**
+ * @struct Servidor::Destino
+ * @details As threads de atendimento escrevem nele sob `trava`, uma resposta inteira
+ * por vez. O descritor de uma conexão é fechado quando o último pedido dela é respondido.
+ */
+struct Servidor::Destino {
+    std::mutex trava;
+    std::ostream* fluxo = nullptr;
+    int descritor = -1;
+
+    ~Destino() {
+#ifdef LABIRINTO_SOCKET_UNIX
+        if (descritor >= 0) ::close(descritor);
+#endif
+    }
+
+    void escrever(const std::string& resposta) {
+        std::lock_guard<std::mutex> guarda(trava);
+        if (fluxo) {
+            *fluxo << resposta;
+            fluxo->flush();
+            return;
+        }
+#ifdef LABIRINTO_SOCKET_UNIX
+        // Um cliente que fechou a conexão só perde as próprias respostas
+        size_t enviado = 0;
+        while (enviado < resposta.size()) {
+            const ssize_t n = ::write(descritor, resposta.data() + enviado, resposta.size() - enviado);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) return;
+            enviado += static_cast<size_t>(n);
+        }
+#endif
+    }
+};
+
+/**
+ * @brief Cria o servidor, com o cache vazio.
+ */
+Servidor::Servidor(const Configuracao& configuracao) : configuracao(configuracao) {
+    if (this->configuracao.threads <= 0) {
+        this->configuracao.threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+    this->configuracao.capacidadeCache = std::max<size_t>(1, this->configuracao.capacidadeCache);
+}
+
+/**
+ * @brief Busca o cenário no cache pelo hash do conteúdo, ou o carrega.
+ * @details A carga e o Floyd-Warshall acontecem fora da trava do cache; se dois pedidos
+ * carregarem o mesmo cenário ao mesmo tempo, o primeiro a terminar entra no cache e o
+ * outro passa a usá-lo.
+ */
+std::shared_ptr<Servidor::Cenario> Servidor::obterCenario(const std::string& conteudo, const std::string& nome, std::string& erro) {
+    const uint64_t chave = hashConteudo(conteudo);
+    {
+        std::lock_guard<std::mutex> guarda(travaCache);
+        auto it = cache.find(chave);
+        if (it != cache.end() && it->second.first->conteudo == conteudo) {
+            usoRecente.splice(usoRecente.begin(), usoRecente, it->second.second);
+            return it->second.first;
+        }
+    }
+
+    auto cenario = std::make_shared<Cenario>();
+    std::istringstream entrada(conteudo);
+    if (!cenario->simulador.carregar(entrada, nome)) {
+        erro = "falha ao carregar o cenário";
+        return nullptr;
+    }
+    // Recusa antes do Floyd-Warshall, que é O(V²) em memória
+    const int64_t estimativa = cenario->simulador.estimarMemoria().total();
+    if (configuracao.limiteMemoriaMiB > 0 && estimativa > (static_cast<int64_t>(configuracao.limiteMemoriaMiB) << 20)) {
+        erro = "memória estimada (" + std::to_string(estimativa >> 20) + " MiB) excede o limite de "
+             + std::to_string(configuracao.limiteMemoriaMiB) + " MiB";
+        return nullptr;
+    }
+    cenario->conteudo = conteudo;
+    if (configuracao.passeioPonderado) cenario->simulador.setModoPasseio(Simulador::ModoPasseio::PONDERADO);
+    cenario->simulador.setPoliticaPrisioneiro(configuracao.politica, configuracao.seedPrisioneiro);
+    cenario->simulador.setFilaReparo(configuracao.filaReparo);
+    cenario->simulador.setNivelRegistro(NivelRegistro::RESUMO);
+    if (!cenario->simulador.temCorredoresDinamicos()) {
+        cenario->memoria = cenario->simulador.calcularMemoriaMinotauro();
+    }
+
+    std::lock_guard<std::mutex> guarda(travaCache);
+    auto it = cache.find(chave);
+    if (it != cache.end()) {
+        // Outro pedido carregou o mesmo conteúdo (ou colidiu o hash): fica o do cache
+        if (it->second.first->conteudo == conteudo) return it->second.first;
+        usoRecente.erase(it->second.second);
+        cache.erase(it);
+    }
+    usoRecente.push_front(chave);
+    cache.emplace(chave, std::make_pair(cenario, usoRecente.begin()));
+    while (cache.size() > configuracao.capacidadeCache) {
+        cache.erase(usoRecente.back()); // pedidos em andamento mantêm o cenário vivo
+        usoRecente.pop_back();
+    }
+    return cenario;
+}
+
+/**
+ * @brief Interpreta um pedido, simula e formata a resposta.
+ */
+std::string Servidor::responder(const std::string& pedido, bool& encerrar) {
+    encerrar = false;
+    std::map<std::string, ValorJson> campos;
+    if (!lerObjetoJson(pedido, campos)) {
+        return respostaErro("", "pedido inválido: esperado um objeto JSON por linha");
+    }
+    std::string campoId;
+    if (campos.count("id")) campoId = "\"id\": " + campos["id"].bruto;
+
+    if (campos.count("comando")) {
+        if (campos["comando"].texto != "encerrar") return respostaErro(campoId, "comando desconhecido");
+        encerrar = true;
+        return "{" + (campoId.empty() ? std::string() : campoId + ", ") + "\"encerrado\": true}\n";
+    }
+
+    long long seed = 1, chance = 1;
+    if ((campos.count("seed") && !lerInteiro(campos["seed"], seed)) || (campos.count("chance") && !lerInteiro(campos["chance"], chance))) {
+        return respostaErro(campoId, "seed e chance devem ser inteiros");
+    }
+
+    std::string conteudo, nome;
+    if (campos.count("cenario")) {
+        conteudo = campos["cenario"].texto;
+        nome = "(cenário do pedido)";
+    } else if (campos.count("arquivo")) {
+        nome = campos["arquivo"].texto;
+        std::ifstream arquivo(nome, std::ios::binary);
+        if (!arquivo.is_open()) return respostaErro(campoId, "não foi possível abrir " + nome);
+        std::ostringstream texto;
+        texto << arquivo.rdbuf();
+        conteudo = texto.str();
+    } else {
+        return respostaErro(campoId, "o pedido precisa de arquivo ou cenario");
+    }
+
+    std::string erro;
+    const std::shared_ptr<Cenario> cenario = obterCenario(conteudo, nome, erro);
+    if (!cenario) return respostaErro(campoId, erro);
+
+    Simulador::ResultadoSimulacao resultado;
+    if (cenario->memoria) {
+        SimuladorLote lote(cenario->simulador, *cenario->memoria);
+        resultado = std::move(lote.run({static_cast<unsigned int>(seed)}, static_cast<int>(chance)).front());
+    } else {
+        std::lock_guard<std::mutex> guarda(cenario->trava);
+        resultado = cenario->simulador.run(static_cast<unsigned int>(seed), static_cast<int>(chance));
+    }
+    std::ostringstream resposta;
+    imprimirJson(resposta, resultado, nullptr, true, nullptr, nullptr, campoId);
+    return resposta.str();
+}
+
+void Servidor::enfileirar(std::string pedido, std::shared_ptr<Destino> destino) {
+    {
+        std::lock_guard<std::mutex> guarda(travaFila);
+        fila.push_back(Tarefa{std::move(pedido), std::move(destino)});
+    }
+    filaMudou.notify_one();
+}
+
+void Servidor::fecharFila() {
+    {
+        std::lock_guard<std::mutex> guarda(travaFila);
+        filaFechada = true;
+    }
+    filaMudou.notify_all();
+}
+
+/**
+ * @brief Laço de uma thread de atendimento.
+ */
+void Servidor::atender() {
+    while (true) {
+        Tarefa tarefa;
+        {
+            std::unique_lock<std::mutex> guarda(travaFila);
+            filaMudou.wait(guarda, [&] { return filaFechada || !fila.empty(); });
+            if (fila.empty()) return; // fechada e vazia
+            tarefa = std::move(fila.front());
+            fila.pop_front();
+        }
+        bool encerrar = false;
+        tarefa.destino->escrever(responder(tarefa.pedido, encerrar));
+        if (encerrar) encerrando = true;
+    }
+}
+
+/**
+ * @brief Atende um fluxo (tipicamente a entrada padrão).
+ */
+int Servidor::atenderFluxo(std::istream& entrada, std::ostream& saida) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < configuracao.threads; ++t) threads.emplace_back(&Servidor::atender, this);
+
+    auto destino = std::make_shared<Destino>();
+    destino->fluxo = &saida;
+    std::string linha;
+    while (!encerrando && std::getline(entrada, linha)) {
+        if (!linha.empty() && linha.back() == '\r') linha.pop_back();
+        if (linha.find_first_not_of(" \t") == std::string::npos) continue;
+        enfileirar(std::move(linha), destino);
+    }
+    fecharFila();
+    for (auto& thread : threads) thread.join();
+    return 0;
+}
+
+/**
+ * @brief Atende um socket Unix.
+ * @details A thread chamadora multiplexa o socket de escuta e as conexões com `poll`
+ * (verificando `encerrando` a cada 100 ms) e enfileira cada linha completa recebida.
+ */
+int Servidor::atenderSocket(const std::string& caminho) {
+#ifdef LABIRINTO_SOCKET_UNIX
+    sockaddr_un endereco{};
+    if (caminho.size() >= sizeof(endereco.sun_path)) {
+        Logger::error(0.0, "Caminho de socket longo demais: {}", Logger::LogSource::OUTRO, caminho);
+        return 1;
+    }
+    const int escuta = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    endereco.sun_family = AF_UNIX;
+    std::strncpy(endereco.sun_path, caminho.c_str(), sizeof(endereco.sun_path) - 1);
+    ::unlink(caminho.c_str());
+    if (escuta < 0 || ::bind(escuta, reinterpret_cast<sockaddr*>(&endereco), sizeof(endereco)) != 0 || ::listen(escuta, 64) != 0) {
+        Logger::error(0.0, "Não foi possível escutar em {}: {}", Logger::LogSource::OUTRO, caminho, std::strerror(errno));
+        if (escuta >= 0) ::close(escuta);
+        return 1;
+    }
+    std::signal(SIGPIPE, SIG_IGN); // cliente que fecha antes da resposta não derruba o servidor
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < configuracao.threads; ++t) threads.emplace_back(&Servidor::atender, this);
+
+    struct Conexao {
+        std::shared_ptr<Destino> destino;
+        std::string pendente; // bytes após a última quebra de linha
+    };
+    std::map<int, Conexao> conexoes;
+    std::vector<pollfd> descritores;
+    char buffer[1 << 16];
+    while (!encerrando) {
+        descritores.assign(1, pollfd{escuta, POLLIN, 0});
+        for (const auto& conexao : conexoes) descritores.push_back(pollfd{conexao.first, POLLIN, 0});
+        if (::poll(descritores.data(), descritores.size(), 100) <= 0) continue;
+
+        if (descritores[0].revents & POLLIN) {
+            const int cliente = ::accept(escuta, nullptr, nullptr);
+            if (cliente >= 0) {
+                auto destino = std::make_shared<Destino>();
+                destino->descritor = cliente;
+                conexoes[cliente].destino = std::move(destino);
+            }
+        }
+        for (size_t k = 1; k < descritores.size(); ++k) {
+            if (!(descritores[k].revents & (POLLIN | POLLHUP | POLLERR))) continue;
+            Conexao& conexao = conexoes[descritores[k].fd];
+            const ssize_t lidos = ::read(descritores[k].fd, buffer, sizeof(buffer));
+            if (lidos <= 0) {
+                conexoes.erase(descritores[k].fd); // fechada quando o último pedido for respondido
+                continue;
+            }
+            conexao.pendente.append(buffer, static_cast<size_t>(lidos));
+            size_t inicio = 0, fim;
+            while ((fim = conexao.pendente.find('\n', inicio)) != std::string::npos) {
+                std::string linha = conexao.pendente.substr(inicio, fim - inicio);
+                if (!linha.empty() && linha.back() == '\r') linha.pop_back();
+                if (linha.find_first_not_of(" \t") != std::string::npos) enfileirar(std::move(linha), conexao.destino);
+                inicio = fim + 1;
+            }
+            conexao.pendente.erase(0, inicio);
+        }
+    }
+
+    fecharFila();
+    for (auto& thread : threads) thread.join();
+    conexoes.clear();
+    ::close(escuta);
+    ::unlink(caminho.c_str());
+    return 0;
+#else
+    Logger::error(0.0, "Sockets Unix não são suportados nesta plataforma ({})", Logger::LogSource::OUTRO, caminho);
+    return 1;
+#endif
+}
@@ -21,7 +21,10 @@
 #include <iostream>
 #include <random> // Para geração de números aleatórios
 #include <limits>
+#include <algorithm>
 #include "utils/Logger.h"
+#include "utils/Estatisticas.h"
+#include "utils/Memoria.h"
 
 /**
  * @brief Construtor da classe Simulador.
@@ -31,8 +34,7 @@ Simulador::Simulador() : fimDeJogo(false), tempoGlobal(0.0), prxMovP(0.0), prxMo
 
 /**
  * @brief Carrega a configuração do labirinto e da simulação a partir de um arquivo de texto.
- * @details Lê o número de vértices, arestas, as conexões do grafo e os parâmetros
- * iniciais da simulação (posições, percepção, comida).
+ * @details Abre o arquivo e delega a leitura para `carregar`.
  * @param nomeArquivo O caminho para o arquivo de configuração.
  * @return `true` se o arquivo foi carregado com sucesso, `false` caso contrário.
  */
@@ -44,6 +46,18 @@ bool Simulador::carregarArquivo(const std::string& nomeArquivo) {
     Logger::error(0.0, "Erro ao abrir arquivo: {}", Logger::LogSource::OUTRO, nomeArquivo);
         return false;
     }
+    return carregar(arquivoEntrada, nomeArquivo);
+}
+
+/**
+ * @brief Carrega a configuração do labirinto e da simulação a partir de um fluxo de texto.
+ * @details Lê o número de vértices, arestas, as conexões do grafo e os parâmetros
+ * iniciais da simulação (posições, percepção, comida), no formato dos arquivos em `data/`.
+ * @param arquivoEntrada O fluxo com o cenário.
+ * @param nomeArquivo O nome usado nas mensagens de log.
+ * @return `true` se o cenário foi carregado com sucesso, `false` caso contrário.
+ */
+bool Simulador::carregar(std::istream& arquivoEntrada, const std::string& nomeArquivo) {
     std::string linha;
     auto lerValor = [&](int& valor) {
         if (std::getline(arquivoEntrada, linha)) {
@@ -67,6 +81,7 @@ bool Simulador::carregarArquivo(const std::string& nomeArquivo) {
             int u, v, peso;
             ss >> u >> v >> peso;
             labirinto.adicionar_aresta(u, v, peso);
+            arestasIniciais.push_back(MudancaCorredor{0.0, u, v, peso});
         } else {
             Logger::error(0.0, "Erro ao ler as arestas do arquivo: {}", Logger::LogSource::OUTRO, nomeArquivo);
             return false;
@@ -79,12 +94,63 @@ bool Simulador::carregarArquivo(const std::string& nomeArquivo) {
         return false;
     }
 
+    // Seção opcional: corredores dinâmicos, "<C>" seguido de C linhas "t u v w"
+    mudancasCorredores.clear();
+    int numMudancas = 0;
+    if (lerValor(numMudancas) && numMudancas > 0) {
+        for (int i = 0; i < numMudancas; ++i) {
+            MudancaCorredor mudanca{};
+            if (!std::getline(arquivoEntrada, linha) || !(std::stringstream(linha) >> mudanca.tempo >> mudanca.u >> mudanca.v >> mudanca.peso)
+                || mudanca.tempo < 0.0 || mudanca.u < 0 || mudanca.v < 0 || mudanca.u >= nV || mudanca.v >= nV || mudanca.u == mudanca.v) {
+                Logger::error(0.0, "Erro ao ler a mudança de corredor {} do arquivo: {}", Logger::LogSource::OUTRO, i + 1, nomeArquivo);
+                return false;
+            }
+            mudancasCorredores.push_back(mudanca);
+        }
+        // Mudanças no mesmo instante são aplicadas na ordem do arquivo
+        std::stable_sort(mudancasCorredores.begin(), mudancasCorredores.end(),
+                         [](const MudancaCorredor& a, const MudancaCorredor& b) { return a.tempo < b.tempo; });
+    }
+
     labirinto.set_saida(vSaid);
+    labirinto.compactar();
+    ContabilidadeMemoria::atual().registrar(Subsistema::GRAFO, labirinto.bytesAlocados());
 
     Logger::info(0.0, "Arquivo carregado com sucesso: {}", Logger::LogSource::OUTRO, nomeArquivo);
+    const EstimativaMemoria estimativa = estimarMemoria();
+    Logger::info(0.0, "Memória estimada: {} KiB (grafo {} KiB, memória do Minotauro {} KiB)", Logger::LogSource::OUTRO,
+                 estimativa.total() >> 10, estimativa.grafo >> 10, estimativa.memoriaMinotauro >> 10);
     return true;
 }
 
+/**
+ * @brief Estima a memória de uma execução sobre o cenário carregado.
+ * @details Mede o grafo e estima as estruturas que `run` aloca em função do número de
+ * salas: as matrizes do Floyd-Warshall (omitidas quando o atalho da pré-análise o
+ * dispensa) e o novelo, que o prisioneiro reserva com uma entrada por sala.
+ * @return Uma struct `EstimativaMemoria`, em bytes.
+ */
+Simulador::EstimativaMemoria Simulador::estimarMemoria() const {
+    EstimativaMemoria estimativa;
+    estimativa.grafo = labirinto.bytesAlocados();
+    const bool minotauroIrrelevante = atalhoPreAnalise && preAnalisar().deterministico();
+    estimativa.memoriaMinotauro = minotauroIrrelevante ? 0 : Minotauro::estimarBytes(nV);
+    estimativa.novelo = static_cast<int64_t>(nV) * static_cast<int64_t>(sizeof(MeuPair<int, int>));
+    return estimativa;
+}
+
+/**
+ * @brief Calcula a memória de caminhos mínimos do labirinto carregado.
+ * @return Um Minotauro no covil cuja memória já foi preenchida por `lembrarCaminhos`.
+ */
+std::unique_ptr<Minotauro> Simulador::calcularMemoriaMinotauro() const {
+    CronometroFase cronometro(Estatisticas::atual().nsMemoriaMinotauro);
+    auto memoria = std::make_unique<Minotauro>(posIniM, percepcaoMinotauro, labirinto, labirinto.getNumVertices());
+    memoria->setTempoMinotauro(0);
+    memoria->lembrarCaminhos();
+    return memoria;
+}
+
 /**
  * @brief Simula uma batalha entre o prisioneiro e o Minotauro.
  * @details Gera um número aleatório de 1 a 100 e verifica se é menor ou igual à
@@ -123,35 +189,67 @@ Simulador::ResultadoSimulacao Simulador::run(unsigned int seed, int chanceBatalh
     resultado.tipoEncontro.clear();
     resultado.tempoEncontro = -1.0;
     resultado.eventos.clear();
+    resultado.registro = nivelRegistro;
     // Inicializa o gerador de números aleatórios com a seed fornecida
     std::mt19937 gerador(seed);
 
-    // Inicializa os agentes
-    Prisioneiro p(vEntr, kitsDeComida);
+    // Atalho da pré-análise: sem encontro possível o Minotauro não afeta o desfecho
+    const bool minotauroIrrelevante = atalhoPreAnalise && preAnalisar().deterministico();
+
+    // Inicializa os agentes; o prisioneiro da execução anterior é reiniciado no lugar
+    // (mapa de visitados e cursores já dimensionados para o labirinto)
+    if (prisioneiro && prisioneiro->getNumSalas() == labirinto.getNumVertices()) {
+        prisioneiro->reiniciar(vEntr, kitsDeComida, politicaPrisioneiro, seedPrisioneiro, nivelRegistro);
+    } else {
+        prisioneiro.emplace(vEntr, kitsDeComida, labirinto.getNumVertices(), politicaPrisioneiro, seedPrisioneiro, nivelRegistro);
+    }
+    Prisioneiro& p = *prisioneiro;
+    const bool registroCompleto = nivelRegistro == NivelRegistro::COMPLETO;
     Minotauro m(posIniM, percepcaoMinotauro, labirinto, labirinto.getNumVertices());
+    m.setFilaReparo(filaReparo);
     // Inclui posição inicial do Minotauro no rastro para exibição consistente
     resultado.caminhoM.clear();
-    resultado.caminhoM.push_back(m.getPos());
+    if (registroCompleto) resultado.caminhoM.push_back(m.getPos());
 
     // Minotauro lembra os caminhos mínimos entre todos os pares de vértices
-    m.lembrarCaminhos();
+    if (!minotauroIrrelevante) {
+        CronometroFase cronometro(Estatisticas::atual().nsMemoriaMinotauro);
+        EscritorTrace::Fase fase(trace, "memoriaMinotauro");
+        m.lembrarCaminhos();
+        ContabilidadeMemoria::atual().registrar(Subsistema::MEMORIA_MINOTAURO, m.bytesAlocados());
+    }
+
+    // Próxima mudança de corredor a aplicar
+    size_t proxMudanca = 0;
 
     // Inicializa os tempos dos próximos movimentos
     prxMovP = 0.0; 
     prxMovM = 0.0;
-    bool minotauroVivo = true;
+    // Minotauro participa da simulação (falso após ser derrotado ou no atalho da pré-análise)
+    bool minotauroVivo = !minotauroIrrelevante;
 
     // inicializa posições de referência para checagem de encontro
     ultimaPosP = p.getPos();
     ultimaPosM = m.getPos();
 
+    CronometroFase cronometroLaco(Estatisticas::atual().nsLacoEventos);
+    EscritorTrace::Fase faseLaco(trace, "lacoEventos");
     while (true){
+        LAB_CONTAR(eventos);
         double tP = prxMovP;
         double tM = minotauroVivo ? prxMovM : std::numeric_limits<double>::infinity();
         double tE = encontroEdgePendente ? tempoEncontroEdge : std::numeric_limits<double>::infinity();
 
         double tNext = std::min(tP, std::min(tM, tE));
 
+        // Mudanças de corredor precedem os eventos dos agentes no mesmo instante.
+        // Agentes em trânsito terminam o deslocamento já iniciado.
+        if (proxMudanca < mudancasCorredores.size() && mudancasCorredores[proxMudanca].tempo <= tNext) {
+            tempoGlobal = mudancasCorredores[proxMudanca].tempo;
+            aplicarMudancaCorredor(mudancasCorredores[proxMudanca++], p, m);
+            continue;
+        }
+
         if (tNext == tE) {
             // Evento: encontro em trânsito no meio da aresta
             tempoGlobal = tempoEncontroEdge;
@@ -160,6 +258,7 @@ Simulador::ResultadoSimulacao Simulador::run(unsigned int seed, int chanceBatalh
             // Resolve batalha
             resultado.tempoEncontro = tempoGlobal;
             resultado.tipoEncontro = "aresta";
+            if (trace) trace->instante("encontro no corredor " + std::to_string(ultimaPosP) + "-" + std::to_string(destAtualP), tempoGlobal);
             if (prisioneiroBatalha(seed, chanceBatalha, gerador)) {
                 Logger::info(tempoGlobal, "Prisioneiro venceu a batalha contra o Minotauro!", Logger::LogSource::PRISIONEIRO);
                 resultado.prisioneiroSobreviveu = true;
@@ -178,7 +277,18 @@ Simulador::ResultadoSimulacao Simulador::run(unsigned int seed, int chanceBatalh
             tempoGlobal = prxMovP;
             // ao iniciar um novo deslocamento do prisioneiro, fixa a última sala
             ultimaPosP = p.getPos();
-            turnoPrisioneiro(p);
+            int custo = turnoPrisioneiro(p);
+            if (custo == 0 && p.getKitsDeComida() > 0 && proxMudanca >= mudancasCorredores.size()) {
+                // Sem mudanças de corredor pendentes o prisioneiro nunca mais se move, e o
+                // Minotauro não o alcança: a espera conta como trânsito para o encontro em
+                // sala e não ocupa corredor para o encontro em aresta. Sem este corte a
+                // simulação não terminaria.
+                resultado.motivoFim = "O prisioneiro ficou preso na sala " + std::to_string(p.getPos()) + " sem poder se mover.";
+                Logger::info(tempoGlobal, resultado.motivoFim, Logger::LogSource::PRISIONEIRO);
+                resultado.prisioneiroSobreviveu = false;
+                fimDeJogo = true;
+                break;
+            }
             // após agendar movimento, verificar cruzamento em aresta
             agendarEncontroEmArestaSeNecessario();
         } else {
@@ -196,17 +306,88 @@ Simulador::ResultadoSimulacao Simulador::run(unsigned int seed, int chanceBatalh
         if (fimDeJogo)
             break;
     }
+    cronometroLaco.parar();
+    faseLaco.encerrar();
 
-    resultado.caminhoP = p.getCaminho();
+    registrarMemoria(p, m);
+    if (labirintoAlterado) {
+        restaurarLabirinto();
+    }
+
+    resultado.caminhoP = p.extrairCaminho();
     resultado.kitsRestantes = p.getKitsDeComida();
     resultado.posFinalP = p.getPos();
     resultado.posFinalM = m.getPos();
     resultado.diasSobrevividos = static_cast<int>(tempoGlobal);
     resultado.tempoReal = tempoGlobal;
 
+    const ContabilidadeMemoria& memoria = ContabilidadeMemoria::atual();
+    Logger::info(tempoGlobal, "Memória: pico de {} KiB nas estruturas contabilizadas, pico de RSS {} KiB", Logger::LogSource::OUTRO,
+                 memoria.picoTotal() >> 10, picoRssBytes() >> 10);
     return resultado;
 }
 
+/**
+ * @brief Registra a memória ocupada por cada subsistema ao fim de `run`.
+ * @details Os vetores não devolvem capacidade, então a linha do tempo, o histórico e
+ * o novelo estão no seu maior tamanho; grafo e memória do Minotauro também são
+ * registrados na carga, em `lembrarCaminhos` e a cada mudança de corredor.
+ * @param p O prisioneiro da simulação.
+ * @param m O Minotauro da simulação.
+ */
+void Simulador::registrarMemoria(const Prisioneiro& p, const Minotauro& m) const {
+    ContabilidadeMemoria& memoria = ContabilidadeMemoria::atual();
+    memoria.registrar(Subsistema::GRAFO, labirinto.bytesAlocados());
+    memoria.registrar(Subsistema::MEMORIA_MINOTAURO, m.bytesAlocados());
+    memoria.registrar(Subsistema::EVENTOS, bytesDeVetor(resultado.eventos));
+    memoria.registrar(Subsistema::NOVELO, static_cast<int64_t>(p.bytesNovelo()));
+    memoria.registrar(Subsistema::HISTORICO, bytesDeVetor(p.getHistorico()));
+}
+
+/**
+ * @brief Aplica uma mudança de corredor durante a simulação.
+ * @details Atualiza o grafo (listas e, na forma compacta, só as salas u e v) e
+ * repara a memória do Minotauro de forma incremental, para que `lembrarProxPasso`
+ * e `lembrarDist` reflitam o labirinto atual já no próximo evento, inclusive no
+ * meio de uma perseguição.
+ * @param mudanca A mudança a aplicar.
+ * @param p Referência ao prisioneiro, cujos cursores de vizinhança são descartados.
+ * @param m Referência ao Minotauro cuja memória será atualizada.
+ */
+void Simulador::aplicarMudancaCorredor(const MudancaCorredor& mudanca, Prisioneiro& p, Minotauro& m) {
+    int pesoAntigo = labirinto.definirPeso(mudanca.u, mudanca.v, mudanca.peso);
+    labirintoAlterado = true;
+    if (mudanca.peso > 0) {
+        Logger::info(tempoGlobal, "O corredor {}-{} agora tem peso {}.", Logger::LogSource::OUTRO, mudanca.u, mudanca.v, mudanca.peso);
+    } else {
+        Logger::info(tempoGlobal, "O corredor {}-{} desabou.", Logger::LogSource::OUTRO, mudanca.u, mudanca.v);
+    }
+    if (trace) {
+        trace->instante("corredor " + std::to_string(mudanca.u) + "-" + std::to_string(mudanca.v)
+                        + (mudanca.peso > 0 ? " peso " + std::to_string(mudanca.peso) : std::string(" desabou")), tempoGlobal);
+    }
+    p.invalidarCursores();
+    m.setTempoMinotauro(tempoGlobal);
+    m.atualizarCorredor(mudanca.u, mudanca.v, pesoAntigo, mudanca.peso);
+    ContabilidadeMemoria::atual().registrar(Subsistema::GRAFO, labirinto.bytesAlocados());
+}
+
+/**
+ * @brief Restaura o labirinto lido do arquivo.
+ * @details Reinsere as arestas na ordem original, para que a ordem dos vizinhos (e
+ * portanto a trajetória do prisioneiro e os sorteios do Minotauro) de uma próxima
+ * simulação seja a mesma de uma execução sem mudanças anteriores.
+ */
+void Simulador::restaurarLabirinto() {
+    labirinto.limpar();
+    for (const auto& aresta : arestasIniciais) {
+        labirinto.adicionar_aresta(aresta.u, aresta.v, aresta.peso);
+    }
+    labirinto.setNumArestas(nA);
+    labirinto.compactar();
+    labirintoAlterado = false;
+}
+
 /**
  * @brief Verifica o estado atual da simulação para determinar se o jogo terminou.
  * @details Checa as três condições de término: prisioneiro sem comida, prisioneiro na saída,
@@ -239,6 +420,7 @@ void Simulador::verificaEstados(Prisioneiro& p, Minotauro& m, bool& fimDeJogo, b
             Logger::info(tempoGlobal, "Prisioneiro encontrou o Minotauro!", Logger::LogSource::PRISIONEIRO);
             resultado.tempoEncontro = tempoGlobal;
             resultado.tipoEncontro = "sala";
+            if (trace) trace->instante("encontro na sala " + std::to_string(p.getPos()), tempoGlobal);
             if (prisioneiroBatalha(seed, chanceBatalha, gerador)) {
                 minotauroVivo = false;
                 resultado.minotauroVivo = false;
@@ -260,26 +442,33 @@ void Simulador::verificaEstados(Prisioneiro& p, Minotauro& m, bool& fimDeJogo, b
  * @details Invoca o método `mover` do prisioneiro para determinar a próxima sala.
  * Com base no custo do movimento, agenda o próximo evento de chegada do prisioneiro (`prxMovP`).
  * @param p Referência ao objeto Prisioneiro.
+ * @return O custo do movimento realizado; 0 se o prisioneiro não conseguiu se mover.
  */
-void Simulador::turnoPrisioneiro(Prisioneiro& p){
+int Simulador::turnoPrisioneiro(Prisioneiro& p){
     p.setTempoPrisioneiro(tempoGlobal);
 
     int pos_antiga = p.getPos();
-    const auto& vizinhos = labirinto.get_vizinhos(p.getPos());
-    int custoMovimento = p.mover(vizinhos);
+    int custoMovimento = p.mover(labirinto.vizinhanca(p.getPos()));
     if (custoMovimento > 0){
         Logger::info(tempoGlobal, "Prisioneiro começando a se mover da sala {} para {}. Custo: {} kits de comida.", Logger::LogSource::PRISIONEIRO, pos_antiga, p.getPos(), custoMovimento);
         prxMovP = tempoGlobal + custoMovimento;
     inicioMovP = tempoGlobal;
     destAtualP = p.getPos();
-    resultado.eventos.push_back(Logger::EventoMovimento{tempoGlobal, prxMovP, "Prisioneiro", pos_antiga, destAtualP, custoMovimento});
+    if (nivelRegistro == NivelRegistro::COMPLETO) {
+        resultado.eventos.push_back(Logger::EventoMovimento{tempoGlobal, prxMovP, "Prisioneiro", pos_antiga, destAtualP, custoMovimento});
+    }
+    if (trace) trace->movimento(EscritorTrace::Agente::PRISIONEIRO, tempoGlobal, prxMovP, pos_antiga, destAtualP, custoMovimento);
     } else {
         Logger::warning(tempoGlobal, "Prisioneiro está preso na sala {} e não conseguiu se mover.", Logger::LogSource::PRISIONEIRO, pos_antiga);
         prxMovP = tempoGlobal + 1.0;
     inicioMovP = tempoGlobal;
     destAtualP = p.getPos();
-    resultado.eventos.push_back(Logger::EventoMovimento{tempoGlobal, prxMovP, "Prisioneiro", pos_antiga, destAtualP, 1});
+    if (nivelRegistro == NivelRegistro::COMPLETO) {
+        resultado.eventos.push_back(Logger::EventoMovimento{tempoGlobal, prxMovP, "Prisioneiro", pos_antiga, destAtualP, 1});
     }
+    if (trace) trace->movimento(EscritorTrace::Agente::PRISIONEIRO, tempoGlobal, prxMovP, pos_antiga, destAtualP, 1);
+    }
+    return custoMovimento;
 }
 
 
@@ -295,6 +484,7 @@ void Simulador::turnoPrisioneiro(Prisioneiro& p){
  * @return Retorna 1 indicando que o turno foi processado.
  */
 int Simulador::turnoMinotauro(Minotauro& m, int posPrisioneiro, std::mt19937& gerador, bool cheiroDePrisioneiro) {
+    LAB_CONTAR(movimentosMinotauro);
     m.setTempoMinotauro((tempoGlobal));
     int posAntiga = m.getPos();
     int proximoPasso = posAntiga;
@@ -308,49 +498,17 @@ int Simulador::turnoMinotauro(Minotauro& m, int posPrisioneiro, std::mt19937& ge
                 proximoPasso = memProx;
             } else {
                 // fallback para comportamento aleatório semelhante ao caso sem cheiro
-                const auto& vizinhos = labirinto.get_vizinhos(posAntiga);
-                int numVizinhos = 0;
-                for (auto no = vizinhos.get_cabeca(); no != nullptr; no = no->prox) {
-                    numVizinhos++;
-                }
-                if (numVizinhos > 0) {
-                    std::uniform_int_distribution<int> dist(0, numVizinhos - 1);
-                    int alvo = dist(gerador);
-                    int i = 0;
-                    for (auto no = vizinhos.get_cabeca(); no != nullptr; no = no->prox) {
-                        if (i == alvo) {
-                            proximoPasso = no->dado.primeiro;
-                            break;
-                        }
-                        i++;
-                    }
-                }
+                proximoPasso = sortearVizinho(posAntiga, gerador);
             }
         }
     } else {
     Logger::info(tempoGlobal, "Minotauro vaga atrás de alimento.", Logger::LogSource::MINOTAURO);
-        const auto& vizinhos = labirinto.get_vizinhos(posAntiga);
-        int numVizinhos = 0;
-        for (auto no = vizinhos.get_cabeca(); no != nullptr; no = no->prox) {
-            numVizinhos++;
-        }
-        if (numVizinhos > 0) {
-            std::uniform_int_distribution<int> dist(0, numVizinhos - 1);
-            int alvo = dist(gerador);
-            int i = 0;
-            for (auto no = vizinhos.get_cabeca(); no != nullptr; no = no->prox) {
-                if (i == alvo) {
-                    proximoPasso = no->dado.primeiro;
-                    break;
-                }
-                i++;
-            }
-        }
+        proximoPasso = sortearVizinho(posAntiga, gerador);
     }
     m.mover(proximoPasso);
     Logger::info(tempoGlobal, "Minotauro movendo da sala {} para {}.", Logger::LogSource::MINOTAURO, posAntiga, proximoPasso);
     if (posAntiga != proximoPasso) {
-        resultado.caminhoM.push_back(proximoPasso);
+        if (nivelRegistro == NivelRegistro::COMPLETO) resultado.caminhoM.push_back(proximoPasso);
         double pesoAresta = static_cast<double>(labirinto.getPesoAresta(posAntiga, proximoPasso));
         if (cheiroDePrisioneiro) {
             prxMovM = tempoGlobal + (pesoAresta / 2.0);
@@ -360,17 +518,46 @@ int Simulador::turnoMinotauro(Minotauro& m, int posPrisioneiro, std::mt19937& ge
         }
         inicioMovM = tempoGlobal;
         destAtualM = proximoPasso;
-    resultado.eventos.push_back(Logger::EventoMovimento{tempoGlobal, prxMovM, "Minotauro", posAntiga, destAtualM, static_cast<int>(pesoAresta)});
+    if (nivelRegistro == NivelRegistro::COMPLETO) {
+        resultado.eventos.push_back(Logger::EventoMovimento{tempoGlobal, prxMovM, "Minotauro", posAntiga, destAtualM, static_cast<int>(pesoAresta)});
+    }
+    if (trace) trace->movimento(EscritorTrace::Agente::MINOTAURO, tempoGlobal, prxMovM, posAntiga, destAtualM, static_cast<int>(pesoAresta));
     } else {
         // Sem vizinhos ou sem movimento: agenda avanço de tempo para evitar loop em t == tempoGlobal
         prxMovM = tempoGlobal + 1.0;
         inicioMovM = tempoGlobal;
         destAtualM = proximoPasso; // permanece na mesma sala
-        resultado.eventos.push_back(Logger::EventoMovimento{tempoGlobal, prxMovM, "Minotauro", posAntiga, destAtualM, 1});
+        if (nivelRegistro == NivelRegistro::COMPLETO) {
+            resultado.eventos.push_back(Logger::EventoMovimento{tempoGlobal, prxMovM, "Minotauro", posAntiga, destAtualM, 1});
+        }
+        if (trace) trace->movimento(EscritorTrace::Agente::MINOTAURO, tempoGlobal, prxMovM, posAntiga, destAtualM, 1);
     }
     return 1;
 }
 
+/**
+ * @brief Sorteia o próximo passo do passeio aleatório do Minotauro.
+ * @details Usa a vizinhança compacta do grafo: no modo uniforme custa um sorteio
+ * e um acesso indexado (mesma sequência de sorteios da varredura de lista antiga);
+ * no modo ponderado consulta a tabela de alias da sala (coluna + moeda).
+ * @param sala A sala atual do Minotauro.
+ * @param gerador Gerador de números aleatórios da simulação.
+ * @return A sala sorteada, ou a própria `sala` se ela não tiver vizinhos.
+ */
+int Simulador::sortearVizinho(int sala, std::mt19937& gerador) const {
+    const int numVizinhos = labirinto.grau(sala);
+    if (numVizinhos == 0) return sala;
+    std::uniform_int_distribution<int> dist(0, numVizinhos - 1);
+    int alvo = dist(gerador);
+    if (modoPasseio == ModoPasseio::PONDERADO) {
+        std::uniform_real_distribution<double> moeda(0.0, 1.0);
+        if (moeda(gerador) >= labirinto.probAlias(sala)[alvo]) {
+            alvo = labirinto.indiceAlias(sala)[alvo];
+        }
+    }
+    return labirinto.vizinhanca(sala).ids[alvo];
+}
+
 /**
  * @brief Verifica se o Minotauro pode detectar o prisioneiro.
  * @param posMinotauro Posição atual do Minotauro.
@@ -380,6 +567,7 @@ int Simulador::turnoMinotauro(Minotauro& m, int posPrisioneiro, std::mt19937& ge
  * @return `true` se a distância entre eles for menor ou igual à percepção, `false` caso contrário.
  */
 bool Simulador::cheiroDePrisioneiro(int posMinotauro, int posPrisioneiro, int percepcao, Minotauro& m) {
+    LAB_CONTAR(verificacoesCheiro);
     // Valida índices antes de consultar a memória do Minotauro
     if (posMinotauro < 0 || posPrisioneiro < 0)
         return false;
@@ -390,31 +578,29 @@ bool Simulador::cheiroDePrisioneiro(int posMinotauro, int posPrisioneiro, int pe
 }
 
 /**
- * @brief Se um encontro em uma aresta for detectado, agenda um novo evento de encontro.
- * @details Chama `detectarEncontroEmAresta` e, se um encontro for iminente,
- * define `encontroEdgePendente` como `true` e armazena o tempo do evento em `tempoEncontroEdge`.
+ * @brief Verifica se o prisioneiro e o Minotauro se cruzam no corredor que percorrem.
+ * @details Cada agente cobre a fração (t - início) / duração do corredor; eles se
+ * cruzam quando as duas frações somam 1. O encontro depende só dos deslocamentos já
+ * iniciados, e não do corredor atual: um corredor que desaba ou muda de peso com os
+ * agentes dentro não altera o deslocamento em curso.
+ * @param tEncontroOut Recebe o instante do encontro, se houver.
+ * @return `true` se os agentes se cruzam antes de algum deles chegar.
  */
 bool Simulador::detectarEncontroEmAresta(double& tEncontroOut) {
+    LAB_CONTAR(verificacoesEncontroAresta);
     // Ambos precisam estar em trânsito
     if (!(prxMovP > tempoGlobal && prxMovM > tempoGlobal)) return false;
 
-    // Devem estar na mesma aresta e em sentidos opostos
-    if (!(ultimaPosP == destAtualM && destAtualP == ultimaPosM)) return false;
-
-    // Comprimento da aresta
-    int Lw = labirinto.getPesoAresta(ultimaPosP, destAtualP);
-    if (Lw <= 0) return false;
-    double L = static_cast<double>(Lw);
+    // Devem estar no mesmo corredor e em sentidos opostos (parados não ocupam corredor)
+    if (ultimaPosP == destAtualP || !(ultimaPosP == destAtualM && destAtualP == ultimaPosM)) return false;
 
-    // Velocidades (constantes ao longo da aresta)
+    // Durações dos deslocamentos (velocidades constantes ao longo do corredor)
     double dP = prxMovP - inicioMovP;
     double dM = prxMovM - inicioMovM;
     if (dP <= 0.0 || dM <= 0.0) return false;
-    double vP = L / dP;
-    double vM = L / dM;
 
-    // Tempo de encontro te após ambos terem iniciado
-    double te = (L + vP*inicioMovP + vM*inicioMovM) / (vP + vM);
+    // Tempo de encontro te: (te - inicioMovP) / dP + (te - inicioMovM) / dM = 1
+    double te = (dP * dM + inicioMovP * dM + inicioMovM * dP) / (dP + dM);
 
     // Valida que te ocorre enquanto ambos ainda estão viajando
     double s = std::max(inicioMovP, inicioMovM);
@@ -0,0 +1,475 @@
+/**
+ * @file SimuladorLote.cpp
+ * @author Thiago Nerton
+ * @brief Implementação do motor de simulação em lote (lockstep).
+ * @details Este arquivo replica, pista a pista, a semântica de `Simulador::run`:
+ * mesma ordem de desempate entre eventos, mesmas fórmulas de tempo contínuo e a
+ * mesma sequência de sorteios por seed. Os laços de seleção de evento e de
+ * verificação de estados percorrem vetores contíguos das pistas ativas.
+ */
+
+#include "labirinto/SimuladorLote.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <utility>
+
+/**
+ * @brief Construtor do lote.
+ * @details Cria a memória compartilhada do Minotauro (Floyd-Warshall uma única
+ * vez, dispensado no atalho da pré-análise) e o prisioneiro de referência, cujo
+ * estado inicial é o estado 0 da trajetória.
+ * @param base O simulador com o cenário carregado.
+ */
+SimuladorLote::SimuladorLote(Simulador& base)
+    : base(base),
+      memoriaPropria(base.posIniM, base.percepcaoMinotauro, base.labirinto, base.labirinto.getNumVertices()),
+      memoria(memoriaPropria),
+      minotauroIrrelevante(base.atalhoPreAnalise && base.preAnalisar().deterministico()),
+      kitsIniciais(base.kitsDeComida),
+      prisioneiro(base.vEntr, base.kitsDeComida, base.labirinto.getNumVertices(),
+                  base.politicaPrisioneiro, base.seedPrisioneiro, NivelRegistro::DESLIGADO) {
+    memoriaPropria.setTempoMinotauro(0);
+    if (!minotauroIrrelevante) {
+        memoriaPropria.lembrarCaminhos();
+    }
+    iniciarTrajetoria();
+}
+
+/**
+ * @brief Construtor do lote sobre uma memória do Minotauro externa.
+ * @details Não calcula o Floyd-Warshall; só o prisioneiro de referência é criado,
+ * com os kits dados.
+ * @param base O simulador com o cenário carregado.
+ * @param memoria A memória de caminhos já calculada, apenas consultada.
+ * @param kitsDeComida Os kits iniciais do prisioneiro.
+ */
+SimuladorLote::SimuladorLote(Simulador& base, const Minotauro& memoria, int kitsDeComida)
+    : base(base),
+      memoriaPropria(base.posIniM, base.percepcaoMinotauro, base.labirinto, 0),
+      memoria(memoria),
+      minotauroIrrelevante(false),
+      kitsIniciais(kitsDeComida),
+      prisioneiro(base.vEntr, kitsDeComida, base.labirinto.getNumVertices(),
+                  base.politicaPrisioneiro, base.seedPrisioneiro, NivelRegistro::DESLIGADO) {
+    iniciarTrajetoria();
+}
+
+/**
+ * @brief Grava o estado 0 da trajetória: nenhum evento do prisioneiro processado ainda.
+ */
+void SimuladorLote::iniciarTrajetoria() {
+    trajPos.push_back(prisioneiro.getPos());
+    trajKits.push_back(prisioneiro.getKitsDeComida());
+    trajUltPos.push_back(prisioneiro.getPos());
+    trajCusto.push_back(0);
+    trajIni.push_back(0.0);
+    trajPrx.push_back(0.0);
+    trajFim.push_back(NENHUM);
+}
+
+/**
+ * @brief Estende a trajetória compartilhada até o estado `j`.
+ * @details Reproduz `turnoPrisioneiro`: o próximo evento ocorre após o custo do
+ * movimento ou, sem movimento, uma unidade de tempo depois. As marcas de fim
+ * seguem a ordem de `verificaEstados` (fome antes da saída).
+ * @param j O índice do estado desejado.
+ */
+void SimuladorLote::garantirEstado(size_t j) {
+    const int vSaida = base.labirinto.get_saida();
+    while (trajPos.size() <= j) {
+        const double t = trajPrx.back();
+        const int ultPos = prisioneiro.getPos();
+        prisioneiro.setTempoPrisioneiro(t);
+        const int custo = prisioneiro.mover(base.labirinto.vizinhanca(ultPos));
+        const int kits = prisioneiro.getKitsDeComida();
+
+        trajPos.push_back(prisioneiro.getPos());
+        trajKits.push_back(kits);
+        trajUltPos.push_back(ultPos);
+        trajCusto.push_back(custo);
+        trajIni.push_back(t);
+        trajPrx.push_back(t + (custo > 0 ? custo : 1.0));
+        trajFim.push_back(!kits ? FOME : (prisioneiro.getPos() == vSaida ? FUGA : NENHUM));
+    }
+}
+
+/**
+ * @brief Copia, para as `n` primeiras pistas, o estado da trajetória em que cada uma está.
+ * @details A cópia (leitura indexada por `passoP`) fica num laço próprio, para que os
+ * laços das fases 1 e 3 leiam apenas vetores contíguos das pistas.
+ */
+void SimuladorLote::coletarTrajetoria(size_t n) {
+    const int* passo = passoP.data();
+    const double* trajetoriaPrx = trajPrx.data();
+    const int* trajetoriaPos = trajPos.data();
+    const int* trajetoriaFim = trajFim.data();
+    double* prx = pistaPrxP.data();
+    int* sala = pistaPosP.data();
+    int* fim = pistaFimP.data();
+    for (size_t i = 0; i < n; ++i) {
+        const int j = passo[i];
+        prx[i] = trajetoriaPrx[j];
+        sala[i] = trajetoriaPos[j];
+        fim[i] = trajetoriaFim[j];
+    }
+}
+
+/**
+ * @brief Executa todas as seeds em lockstep, com os parâmetros do Minotauro do cenário.
+ * @param seeds As seeds, uma por pista.
+ * @param chanceBatalha A chance de vitória do prisioneiro em um encontro.
+ * @return Os resultados na ordem das seeds.
+ */
+std::vector<Simulador::ResultadoSimulacao> SimuladorLote::run(const std::vector<unsigned int>& seeds, int chanceBatalha) {
+    std::vector<Pista> pistas(seeds.size());
+    for (size_t i = 0; i < seeds.size(); ++i) {
+        pistas[i] = Pista{seeds[i], chanceBatalha, base.posIniM, base.percepcaoMinotauro};
+    }
+    return run(pistas);
+}
+
+/**
+ * @brief Executa todas as pistas em lockstep.
+ * @param pistas Seed, chance de batalha, sala inicial e percepção do Minotauro de cada pista.
+ * @return Os resultados na ordem das pistas.
+ */
+std::vector<Simulador::ResultadoSimulacao> SimuladorLote::run(const std::vector<Pista>& pistas) {
+    // Corredores dinâmicos mudam a trajetória do prisioneiro e a memória no meio da
+    // execução; esse caso é delegado, pista a pista, ao simulador escalar.
+    if (base.temCorredoresDinamicos()) {
+        const int posIniM = base.posIniM, percepcaoMinotauro = base.percepcaoMinotauro, kitsDeComida = base.kitsDeComida;
+        resultados.clear();
+        for (const Pista& pista : pistas) {
+            base.posIniM = pista.posIniM;
+            base.percepcaoMinotauro = pista.percepcao;
+            base.kitsDeComida = kitsIniciais;
+            resultados.push_back(base.run(pista.seed, pista.chanceBatalha));
+        }
+        base.posIniM = posIniM;
+        base.percepcaoMinotauro = percepcaoMinotauro;
+        base.kitsDeComida = kitsDeComida;
+        return resultados;
+    }
+
+    const size_t k = pistas.size();
+    const double INF = std::numeric_limits<double>::infinity();
+    numAtivas = k;
+
+    idPista.resize(k);
+    chance.resize(k);
+    percepcao.resize(k);
+    tempo.assign(k, 0.0);
+    passoP.assign(k, 0);
+    posM.resize(k);
+    ultM.resize(k);
+    destM.assign(k, -1);
+    prxM.assign(k, 0.0);
+    iniM.assign(k, 0.0);
+    vivo.assign(k, minotauroIrrelevante ? 0 : 1);
+    vivoRes.assign(k, 1);
+    tAresta.assign(k, INF);
+    tEncontro.assign(k, -1.0);
+    tipoEncontro.assign(k, 0);
+    tipoEvento.assign(k, EV_PRISIONEIRO);
+    motivo.assign(k, NENHUM);
+    pistaPrxP.resize(k);
+    pistaPosP.resize(k);
+    pistaFimP.resize(k);
+    marca.resize(k);
+    gerador.clear();
+    gerador.reserve(k);
+    for (size_t i = 0; i < k; ++i) {
+        idPista[i] = i;
+        chance[i] = pistas[i].chanceBatalha;
+        percepcao[i] = pistas[i].percepcao;
+        posM[i] = ultM[i] = pistas[i].posIniM;
+        gerador.emplace_back(pistas[i].seed);
+    }
+    resultados.assign(k, Simulador::ResultadoSimulacao{});
+    for (Simulador::ResultadoSimulacao& r : resultados) r.registro = NivelRegistro::DESLIGADO;
+
+    coletarTrajetoria(k);
+
+    while (numAtivas > 0) {
+        const size_t n = numAtivas;
+
+        // Fase 1: seleção do próximo evento (mesmo desempate de `run`: aresta, prisioneiro,
+        // Minotauro), sem desvios: só mínimos e seleções sobre vetores contíguos das pistas.
+        // O tempo da pista avança para o evento e o passo do prisioneiro já é consumido.
+        {
+            const double* tP = pistaPrxP.data();
+            const double* tM = prxM.data();
+            const double* tE = tAresta.data();
+            const int* vivoM = vivo.data();
+            double* t = tempo.data();
+            int* tipo = tipoEvento.data();
+            int* passo = passoP.data();
+            int passoMax = 0;
+            for (size_t i = 0; i < n; ++i) {
+                const double m = tM[i];
+                const double tMinotauro = vivoM[i] ? m : INF;
+                const double tNext = std::min(tP[i], std::min(tMinotauro, tE[i]));
+                const int aresta = tNext == tE[i];
+                const int prisioneiro = !aresta & (tNext == tP[i]);
+                t[i] = tNext;
+                tipo[i] = aresta * EV_ARESTA + prisioneiro * EV_PRISIONEIRO + (1 - aresta - prisioneiro) * EV_MINOTAURO;
+                passo[i] += prisioneiro;
+                passoMax = std::max(passoMax, passo[i]);
+            }
+            garantirEstado(static_cast<size_t>(passoMax));
+        }
+
+        // Fase 2: a parte de cada evento que depende da pista (sorteios, memória, encontros)
+        for (size_t i = 0; i < n; ++i) {
+            switch (tipoEvento[i]) {
+                case EV_ARESTA:
+                    tAresta[i] = INF;
+                    tEncontro[i] = tempo[i];
+                    tipoEncontro[i] = 2;
+                    if (batalha(i)) {
+                        vivoRes[i] = 0;
+                        encerrar(i, DERROTOU, true);
+                    } else {
+                        vivoRes[i] = 1;
+                        encerrar(i, DEVORADO, false);
+                    }
+                    break;
+                case EV_PRISIONEIRO: {
+                    const size_t j = passoP[i];
+                    if (trajCusto[j] == 0 && trajKits[j] > 0) {
+                        encerrar(i, PRESO, false);
+                        break;
+                    }
+                    agendarEncontroEmAresta(i);
+                    break;
+                }
+                case EV_MINOTAURO:
+                    eventoMinotauro(i);
+                    agendarEncontroEmAresta(i);
+                    break;
+            }
+        }
+
+        // Fase 3: verificação de estados. O estado do prisioneiro de cada pista é copiado
+        // da trajetória para vetores das pistas; a marca (fome ou fuga na trajetória, ou
+        // encontro em sala) é calculada sem desvios, e só as pistas marcadas são tratadas.
+        coletarTrajetoria(n);
+        {
+            const double* tP = pistaPrxP.data();
+            const double* tM = prxM.data();
+            const double* t = tempo.data();
+            const int* salaP = pistaPosP.data();
+            const int* salaM = posM.data();
+            const int* vivoM = vivo.data();
+            const int* fim = pistaFimP.data();
+            const int* motivoPista = motivo.data();
+            int* marcada = marca.data();
+            for (size_t i = 0; i < n; ++i) {
+                const int parados = (tP[i] <= t[i]) & (tM[i] <= t[i]);
+                const int encontro = parados & (salaP[i] == salaM[i]) & (vivoM[i] != 0);
+                marcada[i] = (motivoPista[i] == NENHUM) & ((fim[i] != NENHUM) | encontro);
+            }
+        }
+        for (size_t i = 0; i < n; ++i) {
+            if (!marca[i]) continue;
+            if (pistaFimP[i] == FOME) {
+                encerrar(i, FOME, false);
+            } else if (pistaFimP[i] == FUGA) {
+                encerrar(i, FUGA, true);
+            } else {
+                tEncontro[i] = tempo[i];
+                tipoEncontro[i] = 1;
+                if (batalha(i)) {
+                    vivo[i] = 0;
+                    vivoRes[i] = 0;
+                } else {
+                    vivoRes[i] = 1;
+                    encerrar(i, DEVORADO, false);
+                }
+            }
+        }
+
+        // Fase 4: compactação das pistas ativas
+        size_t i = 0;
+        while (i < numAtivas) {
+            if (motivo[i] != NENHUM) {
+                trocarPistas(i, numAtivas - 1);
+                numAtivas--;
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    return std::move(resultados);
+}
+
+/**
+ * @brief Processa a chegada do Minotauro de uma pista.
+ * @details Espelha `cheiroDePrisioneiro` + `turnoMinotauro`: o cheiro usa a sala
+ * atual do prisioneiro, e a perseguição mira a sala de onde ele partiu.
+ * @param i A pista.
+ */
+void SimuladorLote::eventoMinotauro(size_t i) {
+    const size_t j = passoP[i];
+    const double t = tempo[i];
+    const int posAntiga = posM[i];
+    const int posPrisioneiro = trajPos[j];
+    const int alvo = trajUltPos[j];
+
+    bool cheiro = false;
+    if (posAntiga >= 0 && posPrisioneiro >= 0) {
+        int dist = memoria.lembrarDist(posAntiga, posPrisioneiro);
+        cheiro = dist >= 0 && dist <= percepcao[i];
+    }
+    ultM[i] = posAntiga;
+
+    int proximoPasso = posAntiga;
+    if (cheiro) {
+        if (posAntiga >= 0 && alvo >= 0) {
+            int memProx = memoria.lembrarProxPasso(posAntiga, alvo);
+            proximoPasso = memProx >= 0 ? memProx : base.sortearVizinho(posAntiga, gerador[i]);
+        }
+    } else {
+        proximoPasso = base.sortearVizinho(posAntiga, gerador[i]);
+    }
+    posM[i] = proximoPasso;
+
+    if (posAntiga != proximoPasso) {
+        double pesoAresta = static_cast<double>(base.labirinto.getPesoAresta(posAntiga, proximoPasso));
+        if (cheiro) {
+            prxM[i] = t + (pesoAresta / 2.0);
+            if (prxM[i] <= t) prxM[i] = t + 0.0001;
+        } else {
+            prxM[i] = t + pesoAresta;
+        }
+    } else {
+        prxM[i] = t + 1.0;
+    }
+    iniM[i] = t;
+    destM[i] = proximoPasso;
+}
+
+/**
+ * @brief Agenda um encontro em aresta para a pista, como `agendarEncontroEmArestaSeNecessario`.
+ * @param i A pista.
+ */
+void SimuladorLote::agendarEncontroEmAresta(size_t i) {
+    const size_t j = passoP[i];
+    const double t = tempo[i];
+    const double prxP = trajPrx[j];
+    const double iniP = trajIni[j];
+    const int ultP = trajUltPos[j];
+    const int destP = trajPos[j];
+
+    if (!(prxP > t && prxM[i] > t)) return;
+    if (ultP == destP || !(ultP == destM[i] && destP == ultM[i])) return;
+    double dP = prxP - iniP;
+    double dM = prxM[i] - iniM[i];
+    if (dP <= 0.0 || dM <= 0.0) return;
+    double te = (dP * dM + iniP * dM + iniM[i] * dP) / (dP + dM);
+    double s = std::max(iniP, iniM[i]);
+    double e = std::min(prxP, prxM[i]);
+    if (te + 1e-9 < s || te - 1e-9 > e) return;
+
+    if (te < tAresta[i] - 1e-9) tAresta[i] = te; // INF: nenhum agendado
+}
+
+/**
+ * @brief Sorteia uma batalha com o gerador da pista (mesmo sorteio de `prisioneiroBatalha`).
+ * @param i A pista.
+ * @return `true` se o prisioneiro vencer.
+ */
+bool SimuladorLote::batalha(size_t i) {
+    std::uniform_int_distribution<int> dist(1, 100);
+    return dist(gerador[i]) <= chance[i];
+}
+
+/**
+ * @brief Encerra uma pista e grava seu resultado na posição original.
+ * @param i A pista.
+ * @param m O motivo do fim.
+ * @param vivoP Se o prisioneiro sobreviveu.
+ */
+void SimuladorLote::encerrar(size_t i, Motivo m, bool vivoP) {
+    motivo[i] = m;
+    const size_t j = passoP[i];
+
+    Simulador::ResultadoSimulacao& r = resultados[idPista[i]];
+    r.prisioneiroSobreviveu = vivoP;
+    r.tempoReal = tempo[i];
+    r.diasSobrevividos = static_cast<int>(tempo[i]);
+    r.kitsRestantes = trajKits[j];
+    r.posFinalP = trajPos[j];
+    r.posFinalM = posM[i];
+    r.minotauroVivo = vivoRes[i];
+    r.tempoEncontro = tEncontro[i];
+    r.tipoEncontro = tipoEncontro[i] == 1 ? "sala" : (tipoEncontro[i] == 2 ? "aresta" : "");
+    switch (m) {
+        case FOME:
+            r.motivoFim = "O prisioneiro morreu de fome no dia " + std::to_string(static_cast<int>(tempo[i])) + ".";
+            break;
+        case FUGA:
+            r.motivoFim = "O prisioneiro escapou com sucesso!";
+            break;
+        case DEVORADO:
+            r.motivoFim = "Prisioneiro foi pego e devorado pelo Minotauro.";
+            break;
+        case DERROTOU:
+            r.motivoFim = "Prisioneiro derrotou o Minotauro.";
+            break;
+        case PRESO:
+            r.motivoFim = "O prisioneiro ficou preso na sala " + std::to_string(trajPos[j]) + " sem poder se mover.";
+            break;
+        case NENHUM:
+            break;
+    }
+}
+
+/**
+ * @brief Troca os estados de duas pistas em todos os vetores paralelos.
+ */
+void SimuladorLote::trocarPistas(size_t a, size_t b) {
+    if (a == b) return;
+    std::swap(idPista[a], idPista[b]);
+    std::swap(chance[a], chance[b]);
+    std::swap(percepcao[a], percepcao[b]);
+    std::swap(tempo[a], tempo[b]);
+    std::swap(passoP[a], passoP[b]);
+    std::swap(posM[a], posM[b]);
+    std::swap(ultM[a], ultM[b]);
+    std::swap(destM[a], destM[b]);
+    std::swap(prxM[a], prxM[b]);
+    std::swap(iniM[a], iniM[b]);
+    std::swap(vivo[a], vivo[b]);
+    std::swap(vivoRes[a], vivoRes[b]);
+    std::swap(tAresta[a], tAresta[b]);
+    std::swap(tEncontro[a], tEncontro[b]);
+    std::swap(tipoEncontro[a], tipoEncontro[b]);
+    std::swap(tipoEvento[a], tipoEvento[b]);
+    std::swap(motivo[a], motivo[b]);
+    std::swap(pistaPrxP[a], pistaPrxP[b]);
+    std::swap(pistaPosP[a], pistaPosP[b]);
+    std::swap(pistaFimP[a], pistaFimP[b]);
+    std::swap(marca[a], marca[b]);
+    std::swap(gerador[a], gerador[b]);
+}
+
+/**
+ * @brief Compara dois resultados nos campos que o lote produz.
+ * @return `true` se forem idênticos.
+ */
+bool SimuladorLote::resultadosIguais(const Simulador::ResultadoSimulacao& a, const Simulador::ResultadoSimulacao& b) {
+    return a.prisioneiroSobreviveu == b.prisioneiroSobreviveu
+        && a.diasSobrevividos == b.diasSobrevividos
+        && a.tempoReal == b.tempoReal
+        && a.kitsRestantes == b.kitsRestantes
+        && a.posFinalP == b.posFinalP
+        && a.posFinalM == b.posFinalM
+        && a.minotauroVivo == b.minotauroVivo
+        && a.tempoEncontro == b.tempoEncontro
+        && a.tipoEncontro == b.tipoEncontro
+        && a.motivoFim == b.motivoFim;
+}
@@ -0,0 +1,241 @@
+/**
+ * @file Varredura.cpp
+ * @author Thiago Nerton
+ * @brief Implementação da varredura de parâmetros (flag `--sweep`).
+ * @details A grade é expandida em pistas (ponto × seed), agrupadas pelos kits, pois
+ * a trajetória do prisioneiro só depende deles. Cada grupo é dividido em blocos de
+ * pontos; cada bloco roda num `SimuladorLote` próprio, numa thread do pool, e grava o
+ * desfecho de cada pista na sua posição. O resumo por ponto é feito no fim,
+ * na ordem da grade, de modo que a tabela não depende do número de threads.
+ */
+
+#include "labirinto/Varredura.h"
+#include "labirinto/SimuladorLote.h"
+#include "utils/Logger.h"
+#include "utils/PoolTrabalho.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+
+namespace {
+
+// Nomes aceitos na especificação, na ordem de `Varredura::Parametro`
+const char* const NOMES_PARAMETROS[Varredura::NUM_PARAMETROS] = {"percepcaoMinotauro", "kitsDeComida", "posIniM", "chanceBatalha"};
+
+// Limite de execuções de uma varredura (os desfechos de todas ficam em memória)
+constexpr size_t MAX_EXECUCOES = size_t(1) << 26;
+
+// Pistas por bloco: blocos pequenos equilibram as threads, grandes amortizam a trajetória
+constexpr size_t MIN_PISTAS_POR_BLOCO = 64;
+
+// Converte um inteiro com sinal; `false` se o texto não for só o número
+bool lerInteiro(const std::string& texto, long& valor) {
+    if (texto.empty()) return false;
+    char* fim = nullptr;
+    valor = std::strtol(texto.c_str(), &fim, 10);
+    return *fim == '\0';
+}
+
+} // namespace
+
+/**
+ * @brief Cria a varredura com os valores do cenário carregado.
+ * @param base O simulador com o cenário.
+ * @param chanceBatalha A chance de batalha padrão.
+ */
+Varredura::Varredura(Simulador& base, int chanceBatalha) : base(base) {
+    valores[PERCEPCAO] = {base.percepcaoMinotauro};
+    valores[KITS] = {base.kitsDeComida};
+    valores[POS_INI_M] = {base.posIniM};
+    valores[CHANCE] = {chanceBatalha};
+}
+
+/**
+ * @brief Interpreta a especificação `nome=inicio:fim[:passo],...`.
+ * @details Salas iniciais do Minotauro fora do labirinto e grades com mais de
+ * `MAX_EXECUCOES` pontos são recusadas aqui, antes de qualquer alocação.
+ * @param especificacao O texto da flag `--sweep`.
+ * @return `true` se todos os itens forem válidos.
+ */
+bool Varredura::definir(const std::string& especificacao) {
+    std::stringstream itens(especificacao);
+    std::string item;
+    while (std::getline(itens, item, ',')) {
+        const size_t igual = item.find('=');
+        const std::string nome = item.substr(0, igual);
+        const auto it = std::find_if(std::begin(NOMES_PARAMETROS), std::end(NOMES_PARAMETROS),
+                                     [&](const char* candidato) { return nome == candidato; });
+        if (igual == std::string::npos || it == std::end(NOMES_PARAMETROS)) {
+            Logger::error(0.0, "Varredura: item inválido '{}' (use percepcaoMinotauro, kitsDeComida, posIniM ou chanceBatalha)",
+                          Logger::LogSource::OUTRO, item);
+            return false;
+        }
+
+        // inicio[:fim[:passo]]
+        std::vector<long> campos;
+        std::stringstream intervalo(item.substr(igual + 1));
+        std::string campo;
+        bool numerico = true;
+        long valor = 0;
+        while (std::getline(intervalo, campo, ':')) {
+            numerico = numerico && lerInteiro(campo, valor);
+            campos.push_back(valor);
+        }
+        const long inicio = campos.empty() ? 0 : campos[0];
+        const long fim = campos.size() > 1 ? campos[1] : inicio;
+        const long passo = campos.size() > 2 ? campos[2] : 1;
+        if (!numerico || campos.empty() || campos.size() > 3 || passo <= 0 || fim < inicio || (fim - inicio) / passo >= long(MAX_EXECUCOES)) {
+            Logger::error(0.0, "Varredura: intervalo inválido em '{}' (use inicio:fim[:passo], com inicio <= fim e passo > 0)",
+                          Logger::LogSource::OUTRO, item);
+            return false;
+        }
+
+        const int parametro = static_cast<int>(it - std::begin(NOMES_PARAMETROS));
+        if (parametro == POS_INI_M && (inicio < 0 || fim >= base.nV)) {
+            Logger::error(0.0, "Varredura: posIniM deve estar entre 0 e {}", Logger::LogSource::OUTRO, base.nV - 1);
+            return false;
+        }
+        valores[parametro].clear();
+        for (long v = inicio; v <= fim; v += passo) valores[parametro].push_back(static_cast<int>(v));
+    }
+
+    if (numPontos() > MAX_EXECUCOES) {
+        Logger::error(0.0, "Varredura: {} pontos excedem o limite de {}", Logger::LogSource::OUTRO, numPontos(), MAX_EXECUCOES);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Número de pontos da grade (produto dos tamanhos dos intervalos).
+ */
+size_t Varredura::numPontos() const {
+    size_t pontos = 1;
+    for (const auto& intervalo : valores) pontos *= intervalo.size();
+    return pontos;
+}
+
+/**
+ * @brief Simula a grade inteira.
+ * @details A pista `p * numSeeds + s` é o ponto `p` (em ordem lexicográfica) com a
+ * seed `s`. Cada bloco reúne pontos com os mesmos kits, todas as seeds de cada um.
+ * @param seeds As seeds de cada ponto.
+ * @param numThreads Threads do pool.
+ * @return Um `Ponto` por combinação de parâmetros.
+ */
+std::vector<Varredura::Ponto> Varredura::run(const std::vector<unsigned int>& seeds, int numThreads) {
+    const size_t numSeeds = seeds.size();
+    const size_t numPontosGrade = numPontos();
+    if (numSeeds == 0 || numPontosGrade * numSeeds > MAX_EXECUCOES) {
+        Logger::error(0.0, "Varredura: {} pontos × {} seeds fora do limite de {} execuções", Logger::LogSource::OUTRO,
+                      numPontosGrade, numSeeds, MAX_EXECUCOES);
+        return {};
+    }
+
+    // Pontos em ordem lexicográfica dos parâmetros
+    std::vector<Ponto> pontos(numPontosGrade);
+    for (size_t p = 0; p < numPontosGrade; ++p) {
+        size_t resto = p;
+        for (int i = NUM_PARAMETROS - 1; i >= 0; --i) {
+            pontos[p].parametros[i] = valores[i][resto % valores[i].size()];
+            resto /= valores[i].size();
+        }
+    }
+
+    // Uma memória do Minotauro para a grade inteira: nenhum parâmetro muda os caminhos mínimos
+    const bool dinamico = base.temCorredoresDinamicos();
+    const int posIniM = base.posIniM, percepcaoMinotauro = base.percepcaoMinotauro, kitsDeComida = base.kitsDeComida;
+    std::unique_ptr<Minotauro> memoria;
+    if (!dinamico) memoria = base.calcularMemoriaMinotauro();
+
+    // Blocos de pontos com os mesmos kits, que dividem a trajetória do prisioneiro. Na
+    // ordem da grade os kits só mudam a cada `pontosPorKits` pontos.
+    PoolTrabalho pool(dinamico ? 1 : numThreads);
+    const size_t numKits = valores[KITS].size();
+    const size_t pontosPorKits = valores[POS_INI_M].size() * valores[CHANCE].size();
+    std::vector<std::vector<size_t>> porKits(numKits);
+    for (size_t p = 0; p < numPontosGrade; ++p) porKits[(p / pontosPorKits) % numKits].push_back(p);
+    const size_t pistasPorBloco =
+        std::max(MIN_PISTAS_POR_BLOCO, numPontosGrade * numSeeds / (static_cast<size_t>(pool.getNumThreads()) * 4));
+    const size_t pontosPorBloco = std::max<size_t>(1, pistasPorBloco / numSeeds);
+    std::vector<std::vector<size_t>> blocos;
+    for (const auto& grupo : porKits) {
+        for (size_t i = 0; i < grupo.size(); i += pontosPorBloco) {
+            blocos.emplace_back(grupo.begin() + i, grupo.begin() + std::min(grupo.size(), i + pontosPorBloco));
+        }
+    }
+
+    // Desfecho de cada pista, gravado pela thread do bloco
+    std::vector<uint8_t> sobreviveu(numPontosGrade * numSeeds);
+    std::vector<uint8_t> encontro(numPontosGrade * numSeeds);
+    std::vector<double> tempoReal(numPontosGrade * numSeeds);
+
+    std::vector<int> ordem(blocos.size());
+    for (size_t b = 0; b < blocos.size(); ++b) ordem[b] = static_cast<int>(b);
+    pool.executar(ordem, [&](int b) {
+        const std::vector<size_t>& bloco = blocos[b];
+        std::vector<SimuladorLote::Pista> pistas;
+        pistas.reserve(bloco.size() * numSeeds);
+        for (size_t p : bloco) {
+            const auto& parametros = pontos[p].parametros;
+            for (unsigned int seed : seeds) {
+                pistas.push_back(SimuladorLote::Pista{seed, parametros[CHANCE], parametros[POS_INI_M], parametros[PERCEPCAO]});
+            }
+        }
+
+        const int kits = pontos[bloco.front()].parametros[KITS];
+        std::vector<Simulador::ResultadoSimulacao> resultados;
+        if (memoria) {
+            resultados = SimuladorLote(base, *memoria, kits).run(pistas);
+        } else {
+            // Corredores dinâmicos: as pistas são simuladas uma a uma por `run` (numa única
+            // thread, pois `run` altera o labirinto e refaz a memória do Minotauro)
+            base.kitsDeComida = kits;
+            for (const SimuladorLote::Pista& pista : pistas) {
+                base.posIniM = pista.posIniM;
+                base.percepcaoMinotauro = pista.percepcao;
+                resultados.push_back(base.run(pista.seed, pista.chanceBatalha));
+            }
+        }
+        for (size_t i = 0; i < resultados.size(); ++i) {
+            const size_t pista = bloco[i / numSeeds] * numSeeds + i % numSeeds;
+            sobreviveu[pista] = resultados[i].prisioneiroSobreviveu;
+            encontro[pista] = resultados[i].tempoEncontro >= 0;
+            tempoReal[pista] = resultados[i].tempoReal;
+        }
+    });
+    base.posIniM = posIniM;
+    base.percepcaoMinotauro = percepcaoMinotauro;
+    base.kitsDeComida = kitsDeComida;
+
+    for (size_t p = 0; p < numPontosGrade; ++p) {
+        Ponto& ponto = pontos[p];
+        double soma = 0.0;
+        for (size_t s = 0; s < numSeeds; ++s) {
+            const size_t pista = p * numSeeds + s;
+            ponto.sobrevivencias += sobreviveu[pista];
+            ponto.encontros += encontro[pista];
+            soma += tempoReal[pista];
+        }
+        ponto.execucoes = static_cast<int>(numSeeds);
+        ponto.tempoMedio = soma / static_cast<double>(numSeeds);
+    }
+    return pontos;
+}
+
+/**
+ * @brief Imprime a tabela: parâmetros, execuções, sobrevivências, taxa, encontros e tempo médio.
+ */
+void Varredura::imprimirTabela(std::ostream& saida, const std::vector<Ponto>& pontos) {
+    for (const char* nome : NOMES_PARAMETROS) saida << nome << '\t';
+    saida << "execucoes\tsobrevivencias\ttaxaSobrevivencia\tencontros\ttempoMedio\n";
+    saida << std::fixed;
+    for (const Ponto& ponto : pontos) {
+        for (int valor : ponto.parametros) saida << valor << '\t';
+        saida << ponto.execucoes << '\t' << ponto.sobrevivencias << '\t' << std::setprecision(4)
+              << static_cast<double>(ponto.sobrevivencias) / ponto.execucoes << '\t' << ponto.encontros << '\t'
+              << std::setprecision(3) << ponto.tempoMedio << '\n';
+    }
+}
@@ -12,8 +12,23 @@
 #include <string>
 #include <vector>
 #include <iomanip>
+#include <cstdlib>
 #include "labirinto/Simulador.h"
+#include "labirinto/SaidaJson.h"
+#include "labirinto/Oraculo.h"
+#include "labirinto/Servidor.h"
+#include "labirinto/SimuladorLote.h"
+#include "labirinto/Varredura.h"
 #include "utils/Logger.h"
+#include "utils/Estatisticas.h"
+#include "utils/Memoria.h"
+#include "utils/Trace.h"
+#include "utils/PoolTrabalho.h"
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <sstream>
 
 // Cores ANSI locais para relatórios humanos (mantém compatível com Logger)
 // Evita depender de símbolos internos de Logger.
@@ -28,13 +43,231 @@ static constexpr const char* RED_HIGHLIGHT = "\033[1;31m";
 /**
  * @struct ConfiguracaoSimulacao
  * @brief Estrutura para manter as configurações da simulação.
- * @note Atualmente não utilizada, mas preparada para futuras expansões.
+ * @details Preenchida pelas flags `--seed`, `--chance`, `--lote`, `--politica`, `--seed-prisioneiro`,
+ * `--registro`, `--threads`, `--sweep`, `--cache`, `--query`, `--oraculo` e `--fila-reparo`.
  */
 struct ConfiguracaoSimulacao {
     unsigned int seed = 1; 
     int chanceDeSobrevivencia = 1; 
+    int lote = 0; // > 0: executa `lote` seeds consecutivas no motor em lockstep
+    PoliticaExploracao politica = PoliticaExploracao::DFS; // exploração do prisioneiro
+    unsigned int seedPrisioneiro = 1; // gerador da política aleatória
+    NivelRegistro registro = NivelRegistro::COMPLETO; // o que `run` grava
+    bool registroExplicito = false; // sem --registro: completo no relatório humano, resumo no JSON
+    int threads = 0; // threads de --batch, --sweep e --serve (0: uma por núcleo)
+    long cache = 64; // cenários em cache no --serve
+    std::string varredura; // especificação de --sweep (vazia: simulação única)
+    bool consultas = false; // --query: responde consultas de distância em vez de simular
+    std::string arquivoConsultas; // consultas do --query (vazio: entrada padrão)
+    Oraculo::Estrategia oraculo = Oraculo::Estrategia::AUTOMATICA; // --oraculo
+    Minotauro::FilaReparo filaReparo = Minotauro::FilaReparo::FIB_HEAP; // reparo da memória do Minotauro
 };
 
+/**
+ * @struct OpcoesSaida
+ * @brief Flags que mudam o que cada simulação calcula e imprime, comuns aos modos.
+ */
+struct OpcoesSaida {
+    bool preAnalise = false;       // análise estática + atalho para desfechos já decididos
+    bool passeioPonderado = false; // Minotauro prefere corredores curtos ao vagar
+    bool stats = false;            // tempos por fase e contadores, em JSON
+    bool memoria = false;          // bytes vivos/pico por subsistema e pico de RSS, em JSON
+    long limiteMemoriaMiB = 0;     // recusa cenários cuja estimativa passa do limite (0: sem limite)
+    bool jsonCompleto = false;     // --json-full: JSON com motivo, rastros e linha do tempo
+};
+
+/**
+ * @brief Converte o nome de um nível de registro (flag `--registro`).
+ * @param nome Um de `desligado`, `resumo` ou `completo`.
+ * @param[out] nivel Recebe o nível correspondente.
+ * @return `true` se o nome for válido.
+ */
+static bool lerNivelRegistro(const std::string& nome, NivelRegistro& nivel) {
+    if (nome == "desligado") nivel = NivelRegistro::DESLIGADO;
+    else if (nome == "resumo") nivel = NivelRegistro::RESUMO;
+    else if (nome == "completo") nivel = NivelRegistro::COMPLETO;
+    else return false;
+    return true;
+}
+
+/**
+ * @brief Converte o nome de uma política de exploração (flag `--politica`).
+ * @param nome Um de `dfs`, `barata`, `aleatoria` ou `comida`.
+ * @param[out] politica Recebe a política correspondente.
+ * @return `true` se o nome for válido.
+ */
+static bool lerPolitica(const std::string& nome, PoliticaExploracao& politica) {
+    if (nome == "dfs") politica = PoliticaExploracao::DFS;
+    else if (nome == "barata") politica = PoliticaExploracao::ARESTA_MAIS_BARATA;
+    else if (nome == "aleatoria") politica = PoliticaExploracao::ALEATORIA;
+    else if (nome == "comida") politica = PoliticaExploracao::CONSCIENTE_DA_COMIDA;
+    else return false;
+    return true;
+}
+
+/**
+ * @brief Converte o nome de uma fila de prioridade (flag `--fila-reparo`).
+ * @param nome Um de `fibheap`, `quaternario`, `pareamento` ou `radix`.
+ * @param[out] fila Recebe a fila correspondente.
+ * @return `true` se o nome for válido.
+ */
+static bool lerFilaReparo(const std::string& nome, Minotauro::FilaReparo& fila) {
+    if (nome == "fibheap") fila = Minotauro::FilaReparo::FIB_HEAP;
+    else if (nome == "quaternario") fila = Minotauro::FilaReparo::QUATERNARIO;
+    else if (nome == "pareamento") fila = Minotauro::FilaReparo::PAREAMENTO;
+    else if (nome == "radix") fila = Minotauro::FilaReparo::RADIX;
+    else return false;
+    return true;
+}
+
+/**
+ * @brief Compara a estimativa de memória do cenário carregado com `--limite-memoria`.
+ * @details Chamada antes de `run`, para recusar um Floyd-Warshall que não cabe antes de
+ * alocá-lo. Registra o motivo no log.
+ * @param simulador O simulador com o cenário carregado (e o atalho da pré-análise já definido).
+ * @param limiteMiB O limite em MiB; <= 0 desliga a verificação.
+ * @return `true` se a estimativa passar do limite.
+ */
+static bool excedeLimiteMemoria(const Simulador& simulador, long limiteMiB) {
+    if (limiteMiB <= 0) return false;
+    const Simulador::EstimativaMemoria estimativa = simulador.estimarMemoria();
+    if (estimativa.total() <= (static_cast<int64_t>(limiteMiB) << 20)) return false;
+    Logger::error(0.0, "Memória estimada ({} MiB, dos quais {} MiB para o Floyd-Warshall) excede o limite de {} MiB",
+                  Logger::LogSource::OUTRO, estimativa.total() >> 20, estimativa.memoriaMinotauro >> 20, limiteMiB);
+    return true;
+}
+
+/**
+ * @brief Lista os cenários de `--batch`.
+ * @details Um diretório contribui com os seus arquivos regulares, em ordem de nome; um
+ * arquivo-lista, com um caminho por linha (linhas vazias e iniciadas por `#` são ignoradas).
+ * @param origem O diretório ou o arquivo-lista.
+ * @param[out] arquivos Os cenários, na ordem em que os resultados serão impressos.
+ * @return `false` se `origem` não puder ser lida.
+ */
+static bool listarCenarios(const std::string& origem, std::vector<std::string>& arquivos) {
+    std::error_code erro;
+    if (std::filesystem::is_directory(origem, erro)) {
+        for (const auto& entrada : std::filesystem::directory_iterator(origem, erro)) {
+            if (entrada.is_regular_file(erro)) arquivos.push_back(entrada.path().string());
+        }
+        std::sort(arquivos.begin(), arquivos.end());
+        return !erro;
+    }
+    std::ifstream lista(origem);
+    if (!lista.is_open()) return false;
+    std::string linha;
+    while (std::getline(lista, linha)) {
+        if (!linha.empty() && linha.back() == '\r') linha.pop_back();
+        if (!linha.empty() && linha[0] != '#') arquivos.push_back(linha);
+    }
+    return true;
+}
+
+/**
+ * @brief Número de salas declarado na primeira linha de um cenário (0 se ilegível).
+ * @details Usado só para escalonar: o Floyd-Warshall do Minotauro custa O(V^3), então
+ * os labirintos grandes começam primeiro e não ficam sozinhos na cauda do lote.
+ */
+static long long salasDeclaradas(const std::string& arquivo) {
+    std::ifstream entrada(arquivo);
+    long long salas = 0;
+    if (!(entrada >> salas) || salas < 0) return 0;
+    return salas;
+}
+
+/**
+ * @brief Modo `--batch`: simula todos os cenários num único processo, em paralelo.
+ * @details Cada cenário é carregado e simulado por uma thread do `PoolTrabalho` (com
+ * roubo de trabalho), do maior para o menor. As linhas JSON são impressas na ordem da
+ * listagem assim que todas as anteriores ficam prontas. Cenários que não carregam geram
+ * uma linha com o campo `erro`. Tempos e contadores (`--stats`) e a contabilidade de
+ * memória (`--memoria`) são por cenário, pois são por thread; o pico de RSS é do processo.
+ * @param origem O diretório ou arquivo-lista.
+ * @param config Seeds, chance, política, registro e threads.
+ * @param opcoes Flags comuns de cálculo e saída.
+ * @return `0` se todos os cenários carregaram, `1` caso contrário.
+ */
+static int executarBatch(const std::string& origem, const ConfiguracaoSimulacao& config, const OpcoesSaida& opcoes) {
+    std::vector<std::string> arquivos;
+    if (!listarCenarios(origem, arquivos)) {
+        Logger::error(0.0, "Não foi possível listar os cenários de {}", Logger::LogSource::OUTRO, origem);
+        return 1;
+    }
+
+    // Maiores primeiro; empates na ordem da listagem
+    std::vector<long long> salas(arquivos.size());
+    std::vector<int> ordem(arquivos.size());
+    for (size_t i = 0; i < arquivos.size(); ++i) {
+        salas[i] = salasDeclaradas(arquivos[i]);
+        ordem[i] = static_cast<int>(i);
+    }
+    std::stable_sort(ordem.begin(), ordem.end(), [&](int a, int b) { return salas[a] > salas[b]; });
+
+    std::mutex travaSaida;
+    std::vector<std::string> linhas(arquivos.size());
+    std::vector<char> pronta(arquivos.size(), 0);
+    size_t proximaLinha = 0;
+    int falhas = 0;
+
+    PoolTrabalho pool(config.threads);
+    pool.executar(ordem, [&](int i) {
+        Estatisticas& estatisticas = Estatisticas::atual();
+        ContabilidadeMemoria& memoria = ContabilidadeMemoria::atual();
+        estatisticas.zerar();
+        memoria.zerar();
+        std::ostringstream linha;
+        bool falhou = false;
+        try {
+            Simulador simulador;
+            CronometroFase cronometroCarga(estatisticas.nsCarga);
+            if (!simulador.carregarArquivo(arquivos[i])) {
+                throw std::runtime_error("falha ao carregar o cenário");
+            }
+            cronometroCarga.parar();
+            if (opcoes.passeioPonderado) simulador.setModoPasseio(Simulador::ModoPasseio::PONDERADO);
+            simulador.setPoliticaPrisioneiro(config.politica, config.seedPrisioneiro);
+            simulador.setFilaReparo(config.filaReparo);
+            simulador.setNivelRegistro(config.registroExplicito ? config.registro : NivelRegistro::RESUMO);
+            Simulador::PreAnalise analise;
+            if (opcoes.preAnalise) {
+                analise = simulador.preAnalisar();
+                simulador.setAtalhoPreAnalise(true);
+            }
+            if (excedeLimiteMemoria(simulador, opcoes.limiteMemoriaMiB)) {
+                throw std::runtime_error("memória estimada excede o limite");
+            }
+            const Simulador::ResultadoSimulacao resultado = simulador.run(config.seed, config.chanceDeSobrevivencia);
+            std::ostringstream campoArquivo;
+            campoArquivo << "\"arquivo\": ";
+            escreverStringJson(campoArquivo, arquivos[i]);
+            imprimirJson(linha, resultado, opcoes.preAnalise ? &analise : nullptr, true, opcoes.stats ? &estatisticas : nullptr,
+                         opcoes.memoria ? &memoria : nullptr, campoArquivo.str());
+        } catch (const std::exception& e) {
+            linha.str("");
+            linha << "{\"arquivo\": ";
+            escreverStringJson(linha, arquivos[i]);
+            linha << ", \"erro\": ";
+            escreverStringJson(linha, e.what());
+            linha << "}\n";
+            falhou = true;
+        }
+
+        // Publica e imprime o prefixo já completo, na ordem da listagem
+        std::lock_guard<std::mutex> guarda(travaSaida);
+        if (falhou) falhas++;
+        linhas[i] = linha.str();
+        pronta[i] = 1;
+        while (proximaLinha < linhas.size() && pronta[proximaLinha]) {
+            std::cout << linhas[proximaLinha];
+            std::string().swap(linhas[proximaLinha]);
+            proximaLinha++;
+        }
+        std::cout.flush();
+    });
+    return falhas == 0 ? 0 : 1;
+}
+
 /**
  * @brief Função principal que executa o programa.
  * @details
@@ -50,21 +283,127 @@ struct ConfiguracaoSimulacao {
  * @return `0` em caso de sucesso, `1` em caso de erro.
  */
 int main(int argc, char* argv[]) {
-    if (argc < 2) {
-        std::cerr << "Uso: " << argv[0] << " <arquivo> [--json-only|--human] [--no-progress]" << std::endl;
+    if (argc < 2 || (std::string(argv[1]) == "--batch" && argc < 3)) {
+        std::cerr << "Uso: " << argv[0] << " <arquivo> [--json-only|--json-full|--human] [--no-progress] [--pre-analise] [--passeio-ponderado]"
+                  << " [--seed N] [--chance N] [--lote K [--validar-lote]]"
+                  << " [--politica dfs|barata|aleatoria|comida] [--seed-prisioneiro N]"
+                  << " [--fila-reparo fibheap|quaternario|pareamento|radix]"
+                  << " [--registro desligado|resumo|completo] [--stats]"
+                  << " [--memoria] [--limite-memoria MiB] [--trace arquivo.json]"
+                  << " [--sweep nome=inicio:fim[:passo],... [--threads N]]"
+                  << " [--query [consultas] [--oraculo auto|memoria|dijkstra] [--threads N]]" << std::endl;
+        std::cerr << "     " << argv[0] << " --batch <diretorio|lista> [--threads N] [flags de simulação]" << std::endl;
+        std::cerr << "     " << argv[0] << " --serve [socket] [--threads N] [--cache N] [--limite-memoria MiB]"
+                  << " [--passeio-ponderado] [--politica P] [--seed-prisioneiro N] [--fila-reparo F]" << std::endl;
         return 1;
     }
-    // Nome do arquivo passado como argumento
-    std::string nomeArquivo = argv[1];
+    // Nome do arquivo (com --batch, do diretório/lista de cenários; com --serve, do socket
+    // opcional) passado como argumento
+    const bool batch = std::string(argv[1]) == "--batch";
+    const bool servir = std::string(argv[1]) == "--serve";
+    const bool comSocket = servir && argc > 2 && std::string(argv[2]).rfind("--", 0) != 0;
+    std::string nomeArquivo = batch || comSocket ? argv[2] : (servir ? "" : argv[1]);
     bool jsonOnly = false;
     bool humanReport = true; // padrão
     bool showProgress = true; // novo: controlar logs de progresso
-    // Parseia múltiplas flags opcionais a partir do 2º argumento
-    for (int i = 2; i < argc; ++i) {
+    bool validarLote = false; // compara cada pista do lote com `Simulador::run`
+    OpcoesSaida opcoes; // --pre-analise, --passeio-ponderado, --stats, --memoria, --json-full
+    std::string arquivoTrace; // Chrome trace-event JSON das fases e da linha do tempo (vazio: sem trace)
+    ConfiguracaoSimulacao config;
+    // Parseia múltiplas flags opcionais após o arquivo
+    for (int i = batch || comSocket ? 3 : 2; i < argc; ++i) {
         std::string flag = argv[i];
         if (flag == "--json-only") { jsonOnly = true; humanReport = false; }
+        else if (flag == "--json-full") { jsonOnly = true; humanReport = false; opcoes.jsonCompleto = true; }
         else if (flag == "--human") { humanReport = true; jsonOnly = false; }
         else if (flag == "--no-progress") { showProgress = false; }
+        else if (flag == "--pre-analise") { opcoes.preAnalise = true; }
+        else if (flag == "--passeio-ponderado") { opcoes.passeioPonderado = true; }
+        else if (flag == "--validar-lote") { validarLote = true; }
+        else if (flag == "--stats") { opcoes.stats = true; }
+        else if (flag == "--memoria") { opcoes.memoria = true; }
+        else if (flag == "--limite-memoria" && i + 1 < argc) { opcoes.limiteMemoriaMiB = std::strtol(argv[++i], nullptr, 10); }
+        else if (flag == "--trace" && i + 1 < argc) { arquivoTrace = argv[++i]; }
+        else if (flag == "--sweep" && i + 1 < argc) { config.varredura = argv[++i]; }
+        else if (flag == "--query") {
+            config.consultas = true;
+            if (i + 1 < argc && std::string(argv[i + 1]).rfind("--", 0) != 0) config.arquivoConsultas = argv[++i];
+        }
+        else if (flag == "--oraculo" && i + 1 < argc) {
+            const std::string estrategia = argv[++i];
+            if (estrategia == "auto") config.oraculo = Oraculo::Estrategia::AUTOMATICA;
+            else if (estrategia == "memoria") config.oraculo = Oraculo::Estrategia::MEMORIA;
+            else if (estrategia == "dijkstra") config.oraculo = Oraculo::Estrategia::DIJKSTRA;
+            else {
+                std::cerr << "Oráculo desconhecido: " << estrategia << " (use auto, memoria ou dijkstra)" << std::endl;
+                return 1;
+            }
+        }
+        else if (flag == "--politica" && i + 1 < argc) {
+            if (!lerPolitica(argv[++i], config.politica)) {
+                std::cerr << "Política desconhecida: " << argv[i] << " (use dfs, barata, aleatoria ou comida)" << std::endl;
+                return 1;
+            }
+        }
+        else if (flag == "--fila-reparo" && i + 1 < argc) {
+            if (!lerFilaReparo(argv[++i], config.filaReparo)) {
+                std::cerr << "Fila desconhecida: " << argv[i] << " (use fibheap, quaternario, pareamento ou radix)" << std::endl;
+                return 1;
+            }
+        }
+        else if (flag == "--registro" && i + 1 < argc) {
+            if (!lerNivelRegistro(argv[++i], config.registro)) {
+                std::cerr << "Nível de registro desconhecido: " << argv[i] << " (use desligado, resumo ou completo)" << std::endl;
+                return 1;
+            }
+            config.registroExplicito = true;
+        }
+        else if ((flag == "--seed" || flag == "--chance" || flag == "--lote" || flag == "--seed-prisioneiro" || flag == "--threads"
+                  || flag == "--cache") && i + 1 < argc) {
+            long valor = std::strtol(argv[++i], nullptr, 10);
+            if (flag == "--seed") config.seed = static_cast<unsigned int>(valor);
+            else if (flag == "--threads") config.threads = static_cast<int>(valor);
+            else if (flag == "--cache") config.cache = valor;
+            else if (flag == "--chance") config.chanceDeSobrevivencia = static_cast<int>(valor);
+            else if (flag == "--seed-prisioneiro") config.seedPrisioneiro = static_cast<unsigned int>(valor);
+            else config.lote = static_cast<int>(valor);
+        }
+    }
+    if (opcoes.jsonCompleto && (batch || servir || config.lote > 0 || !config.varredura.empty())) {
+        std::cerr << "--json-full vale apenas para uma simulação única" << std::endl;
+        return 1;
+    }
+    // O trace é a linha do tempo de uma execução: lote, varredura e consultas não a têm
+    // (e os cenários dinâmicos do lote caem em run(), que escreveria uma por seed)
+    if (!arquivoTrace.empty() && (batch || servir || config.lote > 0 || !config.varredura.empty() || config.consultas)) {
+        std::cerr << "--trace vale apenas para uma simulação única" << std::endl;
+        return 1;
+    }
+    if (config.lote > 0) { jsonOnly = true; humanReport = false; } // lote só produz JSON Lines
+    if (!config.varredura.empty()) { jsonOnly = true; humanReport = false; } // varredura só produz a tabela
+    if (config.consultas) { jsonOnly = true; humanReport = false; } // consultas só produzem JSON Lines
+
+    if (batch) {
+        // Uma linha JSON por cenário; o log (só erros) vai para stderr
+        Logger::setLevel(LogLevel::ERROR);
+        Logger::setDestino(std::cerr);
+        return executarBatch(nomeArquivo, config, opcoes);
+    }
+
+    if (servir) {
+        // Respostas em JSON Lines na saída padrão ou no socket; o log (só erros) vai para stderr
+        Logger::setLevel(LogLevel::ERROR);
+        Logger::setDestino(std::cerr);
+        Servidor::Configuracao configuracao;
+        configuracao.threads = config.threads;
+        configuracao.capacidadeCache = static_cast<size_t>(std::max(1L, config.cache));
+        configuracao.passeioPonderado = opcoes.passeioPonderado;
+        configuracao.politica = config.politica;
+        configuracao.seedPrisioneiro = config.seedPrisioneiro;
+        configuracao.filaReparo = config.filaReparo;
+        configuracao.limiteMemoriaMiB = opcoes.limiteMemoriaMiB;
+        Servidor servidor(configuracao);
+        return comSocket ? servidor.atenderSocket(nomeArquivo) : servidor.atenderFluxo(std::cin, std::cout);
     }
 
     // Definir nível de log conforme modo selecionado antes de qualquer log
@@ -85,17 +424,117 @@ int main(int argc, char* argv[]) {
     }
 
     try {
+        Estatisticas& estatisticas = Estatisticas::atual();
+        estatisticas.zerar();
+        ContabilidadeMemoria& memoria = ContabilidadeMemoria::atual();
+        memoria.zerar();
+        std::unique_ptr<EscritorTrace> trace;
+        if (!arquivoTrace.empty()) {
+            trace = std::make_unique<EscritorTrace>(arquivoTrace);
+            if (!trace->aberto()) {
+                Logger::error(0.0, "Não foi possível criar o trace {}", Logger::LogSource::OUTRO, arquivoTrace);
+                return 1;
+            }
+        }
         Simulador simulation;
+        simulation.setTrace(trace.get());
+        CronometroFase cronometroCarga(estatisticas.nsCarga);
+        EscritorTrace::Fase faseCarga(trace.get(), "carga");
     if (!simulation.carregarArquivo(nomeArquivo)) {
             return 1; // Encerra se o arquivo não puder ser carregado
         }
+        cronometroCarga.parar();
+        faseCarga.encerrar();
+
+        if (config.consultas) {
+            // Uma linha JSON por consulta; o Floyd-Warshall só é usado se couber no limite
+            std::ifstream arquivoConsultas;
+            if (!config.arquivoConsultas.empty()) {
+                arquivoConsultas.open(config.arquivoConsultas);
+                if (!arquivoConsultas.is_open()) {
+                    Logger::error(0.0, "Erro: Não foi possível acessar o arquivo {}", Logger::LogSource::OUTRO, config.arquivoConsultas);
+                    return 1;
+                }
+            }
+            Oraculo oraculo(simulation);
+            const std::vector<Oraculo::Consulta> consultas =
+                oraculo.lerConsultas(config.arquivoConsultas.empty() ? std::cin : arquivoConsultas);
+            Oraculo::Estrategia estrategia = config.oraculo;
+            if (estrategia == Oraculo::Estrategia::AUTOMATICA) {
+                estrategia = oraculo.escolher(consultas, config.threads, opcoes.limiteMemoriaMiB);
+            } else if (estrategia == Oraculo::Estrategia::MEMORIA && excedeLimiteMemoria(simulation, opcoes.limiteMemoriaMiB)) {
+                return 1;
+            }
+            return oraculo.responder(std::cout, consultas, estrategia, config.threads) == 0 ? 0 : 1;
+        }
         // Imprimir cabeçalho estilizado apenas em modo humano
         if (humanReport && !jsonOnly) {
             Logger::imprimirInicioSimulacao(simulation.getSimulacaoInfo());
         }
 
-        Simulador::ResultadoSimulacao resultado = simulation.run(1, 1); // Seed 1, Chance 1%
+        if (opcoes.passeioPonderado) {
+            simulation.setModoPasseio(Simulador::ModoPasseio::PONDERADO);
+        }
+        simulation.setPoliticaPrisioneiro(config.politica, config.seedPrisioneiro);
+        simulation.setFilaReparo(config.filaReparo);
+        // O JSON resumido não traz rastros nem linha do tempo: sem relatório humano nem
+        // --json-full, basta o resumo
+        if (!config.registroExplicito && jsonOnly && !opcoes.jsonCompleto) config.registro = NivelRegistro::RESUMO;
+        simulation.setNivelRegistro(config.registro);
+
+        Simulador::PreAnalise analise;
+        if (opcoes.preAnalise) {
+            analise = simulation.preAnalisar();
+            simulation.setAtalhoPreAnalise(true);
+        }
+
+        // Recusa antes de alocar: a memória do Minotauro é O(V²)
+        if (excedeLimiteMemoria(simulation, opcoes.limiteMemoriaMiB)) {
+            return 1;
+        }
+
+        if (!config.varredura.empty()) {
+            // Cada ponto da grade com as seeds de --lote (ou só --seed)
+            Varredura varredura(simulation, config.chanceDeSobrevivencia);
+            if (!varredura.definir(config.varredura)) {
+                return 1;
+            }
+            std::vector<unsigned int> seeds(std::max(1, config.lote));
+            for (size_t i = 0; i < seeds.size(); ++i) seeds[i] = config.seed + static_cast<unsigned int>(i);
+            const std::vector<Varredura::Ponto> pontos = varredura.run(seeds, config.threads);
+            if (pontos.empty()) {
+                return 1;
+            }
+            Varredura::imprimirTabela(std::cout, pontos);
+            return 0;
+        }
+
+        if (config.lote > 0) {
+            // Seeds consecutivas a partir de --seed, todas em lockstep
+            std::vector<unsigned int> seeds(config.lote);
+            for (int i = 0; i < config.lote; ++i) seeds[i] = config.seed + static_cast<unsigned int>(i);
+            SimuladorLote lote(simulation);
+            std::vector<Simulador::ResultadoSimulacao> resultados = lote.run(seeds, config.chanceDeSobrevivencia);
+            if (!validarLote) {
+                for (const auto& r : resultados) imprimirJson(std::cout, r, opcoes.preAnalise ? &analise : nullptr, true);
+                return 0;
+            }
+            int divergencias = 0;
+            for (size_t i = 0; i < seeds.size(); ++i) {
+                Simulador::ResultadoSimulacao referencia = simulation.run(seeds[i], config.chanceDeSobrevivencia);
+                if (!SimuladorLote::resultadosIguais(resultados[i], referencia)) {
+                    Logger::error(0.0, "Lote diverge de run() na seed {}", Logger::LogSource::OUTRO, seeds[i]);
+                    divergencias++;
+                }
+            }
+            std::cout << "{ \"lote\": " << config.lote << ", \"divergencias\": " << divergencias << " }\n";
+            return divergencias == 0 ? 0 : 1;
+        }
+
+        Simulador::ResultadoSimulacao resultado = simulation.run(config.seed, config.chanceDeSobrevivencia);
 
+    CronometroFase cronometroRelatorio(estatisticas.nsRelatorio);
+    EscritorTrace::Fase faseRelatorio(trace.get(), "relatorio");
     if (humanReport && !jsonOnly) {
     // --- LINHA DO TEMPO DETALHADA (ANTES DO RELATÓRIO FINAL) ---
     if (showProgress && !resultado.eventos.empty()) {
@@ -183,26 +622,34 @@ int main(int argc, char* argv[]) {
         std::cout << std::endl;
     };
     
-    print_caminho("Prisioneiro", resultado.caminhoP);
+    print_caminho("Prisioneiro", resultado.caminhoP.decodificar());
     print_caminho("Minotauro", resultado.caminhoM);
 
     std::cout << "\n" << BOLD << BRONZE << "========================================================" << RESET_COLOR << std::endl;
 }
+    cronometroRelatorio.parar();
+    faseRelatorio.encerrar();
 
         // JSON resumido (somente se solicitado explicitamente ou padrão se jsonOnly)
     if (jsonOnly) {
-        std::cout << "{\n" 
-                  << "  \"sobreviveu\": " << (resultado.prisioneiroSobreviveu ? "true" : "false") << ",\n"
-            << "  \"tempo\": " << resultado.diasSobrevividos << ",\n"
-            << "  \"tempoReal\": " << std::fixed << std::setprecision(6) << resultado.tempoReal << ",\n"
-                  << "  \"kits\": " << resultado.kitsRestantes << ",\n"
-                  << "  \"posP\": " << resultado.posFinalP << ",\n"
-                  << "  \"posM\": " << resultado.posFinalM << ",\n"
-                  << "  \"minotauroVivo\": " << (resultado.minotauroVivo ? "true" : "false") << ",\n"
-                  << "  \"encontro\": { \"ok\": " << (resultado.tempoEncontro >= 0 ? "true" : "false")
-                  << ", \"tipo\": \"" << (resultado.tempoEncontro >= 0 ? resultado.tipoEncontro : "") << "\", \"t\": "
-                  << (resultado.tempoEncontro >= 0 ? resultado.tempoEncontro : -1) << " }\n";
-            std::cout << "}\n";
+            imprimirJson(std::cout, resultado, opcoes.preAnalise ? &analise : nullptr, false, opcoes.stats ? &estatisticas : nullptr,
+                         opcoes.memoria ? &memoria : nullptr, "", opcoes.jsonCompleto);
+        } else if (opcoes.stats || opcoes.memoria) {
+            // Depois do relatório humano, as medidas saem num objeto JSON de uma linha
+            {
+                EscritorJson json(std::cout);
+                json.abrirObjeto();
+                if (opcoes.stats) {
+                    json.chave("estatisticas");
+                    estatisticas.escreverJson(json);
+                }
+                if (opcoes.memoria) {
+                    json.chave("memoria");
+                    memoria.escreverJson(json);
+                }
+                json.fecharObjeto();
+            }
+            std::cout << std::endl;
         }
     } catch (const std::exception& e) {
     Logger::error(0.0, "Uma exceção crítica ocorreu: {}", Logger::LogSource::OUTRO, e.what());
@@ -0,0 +1,175 @@
+# Teste de desempenho: mede um caso e o compara com tests/perf/baseline.json.
+#
+# Uso (via CTest, ver tests/CMakeLists.txt):
+#   cmake -DTIPO=cenario -DNOME=<caso> -DSALAS=<n> -DSEED=<s> -DSIMULADOR=<exe> -DBENCH=<exe>
+#         -DBASELINE=<json> -DDIR_TRABALHO=<dir> -P desempenho.cmake
+#   cmake -DTIPO=bench -DNOME=<caso> -DFILTRO=<nome do caso da bancada> [-DCASO=<nome>]
+#         [-DANOTACOES=<a|b>] -DBENCH=<exe> -DBASELINE=<json> -DDIR_TRABALHO=<dir> -P desempenho.cmake
+#
+# - cenario: gera um labirinto de SALAS salas (labirinto_bench --gerar), roda o simulador
+#   com --stats --memoria e compara o tempo das fases (carga + Floyd–Warshall + laço de
+#   eventos), os eventos por segundo do laço e o pico de RSS. Melhor de 3 execuções.
+# - bench: roda labirinto_bench --filtro FILTRO e compara a mediana de ns por operação
+#   do caso de nome exatamente CASO (padrão: FILTRO) e, se dadas em ANOTACOES (separadas
+#   por '|'), as anotações do caso, em que maior é melhor (ex.: a aceleração sobre outros
+#   casos do mesmo filtro).
+#
+# Com a variável de ambiente LABIRINTO_PERF_REGISTRAR=1 o teste grava as medidas como a
+# nova referência do caso, em vez de comparar.
+cmake_minimum_required(VERSION 3.19) # string(JSON)
+
+set(REPETICOES 3)
+
+# Converte um decimal sem expoente ("12.345678") em inteiro com CASAS casas implícitas
+function(decimal_para_inteiro VALOR CASAS SAIDA)
+    if (NOT VALOR MATCHES "^([0-9]+)(\\.([0-9]*))?$")
+        message(FATAL_ERROR "Número inesperado no JSON: '${VALOR}'")
+    endif()
+    set(inteiro "${CMAKE_MATCH_1}")
+    set(fracao "${CMAKE_MATCH_3}000000000000")
+    string(SUBSTRING "${fracao}" 0 ${CASAS} fracao)
+    string(REGEX REPLACE "^0+" "" numero "${inteiro}${fracao}")
+    if (numero STREQUAL "")
+        set(numero 0)
+    endif()
+    set(${SAIDA} ${numero} PARENT_SCOPE)
+endfunction()
+
+# Registra uma métrica do caso: valor inteiro, sentido (menor ou maior é melhor) e tolerância
+macro(medida METRICA VALOR SENTIDO TOLERANCIA)
+    list(APPEND metricas ${METRICA})
+    set(valor_${METRICA} ${VALOR})
+    set(sentido_${METRICA} ${SENTIDO})
+    set(tolerancia_${METRICA} ${TOLERANCIA})
+endmacro()
+
+file(READ "${BASELINE}" referencia)
+string(JSON tolTempo GET "${referencia}" toleranciaTempoPct)
+string(JSON tolMemoria GET "${referencia}" toleranciaMemoriaPct)
+file(MAKE_DIRECTORY "${DIR_TRABALHO}")
+
+set(metricas)
+if (TIPO STREQUAL "cenario")
+    set(cenario "${DIR_TRABALHO}/${NOME}.txt")
+    execute_process(COMMAND "${BENCH}" --gerar ${SALAS} ${SEED} "${cenario}" RESULT_VARIABLE rc)
+    if (NOT rc EQUAL 0)
+        message(FATAL_ERROR "Falha ao gerar o cenário ${cenario}")
+    endif()
+    foreach(i RANGE 1 ${REPETICOES})
+        execute_process(COMMAND "${SIMULADOR}" "${cenario}" --json-only --stats --memoria
+                        OUTPUT_VARIABLE saida RESULT_VARIABLE rc)
+        if (NOT rc EQUAL 0)
+            message(FATAL_ERROR "O simulador falhou (código ${rc}):\n${saida}")
+        endif()
+        set(ns 0)
+        foreach(fase carga memoriaMinotauro lacoEventos)
+            string(JSON ms GET "${saida}" estatisticas tempoMs ${fase})
+            decimal_para_inteiro("${ms}" 6 nsFase)
+            math(EXPR ns "${ns} + ${nsFase}")
+        endforeach()
+        set(nsLaco ${nsFase}) # a última fase é o laço de eventos
+        string(JSON rss GET "${saida}" memoria picoRssBytes)
+        string(JSON tipoContadores TYPE "${saida}" estatisticas contadores)
+        # Melhor execução: menor tempo e RSS, maior vazão
+        if (i EQUAL 1 OR ns LESS melhorNs)
+            set(melhorNs ${ns})
+        endif()
+        if (i EQUAL 1 OR rss LESS melhorRss)
+            set(melhorRss ${rss})
+        endif()
+        # Sem contadores compilados (LABIRINTO_ESTATISTICAS=OFF) não há vazão
+        if (tipoContadores STREQUAL "OBJECT" AND nsLaco GREATER 0)
+            string(JSON eventos GET "${saida}" estatisticas contadores eventos)
+            math(EXPR eps "${eventos} * 1000000000 / ${nsLaco}")
+            if (NOT DEFINED melhorEps OR eps GREATER melhorEps)
+                set(melhorEps ${eps})
+            endif()
+        endif()
+    endforeach()
+    medida(tempoNs ${melhorNs} menor ${tolTempo})
+    medida(picoRssBytes ${melhorRss} menor ${tolMemoria})
+    if (DEFINED melhorEps)
+        medida(eventosPorSegundo ${melhorEps} maior ${tolTempo})
+    endif()
+elseif (TIPO STREQUAL "bench")
+    if (NOT DEFINED CASO)
+        set(CASO "${FILTRO}")
+    endif()
+    set(json "${DIR_TRABALHO}/${NOME}.json")
+    execute_process(COMMAND "${BENCH}" --filtro "${FILTRO}" --json "${json}" RESULT_VARIABLE rc OUTPUT_QUIET)
+    if (NOT rc EQUAL 0)
+        message(FATAL_ERROR "labirinto_bench falhou (código ${rc})")
+    endif()
+    file(READ "${json}" resultado)
+    string(JSON numCasos LENGTH "${resultado}" benchmarks)
+    set(mediana "")
+    if (numCasos GREATER 0)
+        math(EXPR ultimo "${numCasos} - 1")
+        foreach(i RANGE ${ultimo})
+            string(JSON nomeCaso GET "${resultado}" benchmarks ${i} nome)
+            if (nomeCaso STREQUAL CASO)
+                string(JSON mediana GET "${resultado}" benchmarks ${i} medianaNsPorOp)
+                set(indiceCaso ${i})
+            endif()
+        endforeach()
+    endif()
+    if (mediana STREQUAL "")
+        message(FATAL_ERROR "O caso ${CASO} não foi medido")
+    endif()
+    decimal_para_inteiro("${mediana}" 3 mediana) # milésimos de ns
+    medida(medianaPsPorOp ${mediana} menor ${tolTempo})
+    string(REPLACE "|" ";" ANOTACOES "${ANOTACOES}")
+    foreach(anotacao IN LISTS ANOTACOES)
+        string(JSON valor ERROR_VARIABLE erro GET "${resultado}" benchmarks ${indiceCaso} ${anotacao})
+        if (erro)
+            message(FATAL_ERROR "O caso ${CASO} não anotou ${anotacao}")
+        endif()
+        decimal_para_inteiro("${valor}" 3 valor) # milésimos
+        medida(${anotacao}Milesimos ${valor} maior ${tolTempo})
+    endforeach()
+else()
+    message(FATAL_ERROR "TIPO deve ser cenario ou bench")
+endif()
+
+# Grava as medidas como a nova referência do caso
+if ("$ENV{LABIRINTO_PERF_REGISTRAR}" STREQUAL "1")
+    set(caso "{}")
+    foreach(metrica IN LISTS metricas)
+        string(JSON caso SET "${caso}" ${metrica} ${valor_${metrica}})
+    endforeach()
+    string(JSON referencia SET "${referencia}" casos ${NOME} "${caso}")
+    file(WRITE "${BASELINE}" "${referencia}\n")
+    message(STATUS "Referência de ${NOME} registrada: ${caso}")
+    return()
+endif()
+
+# Comparação com a referência
+string(JSON caso ERROR_VARIABLE erro GET "${referencia}" casos ${NOME})
+if (erro)
+    message(FATAL_ERROR "Sem referência para ${NOME}; registre com LABIRINTO_PERF_REGISTRAR=1 ctest -L perf")
+endif()
+set(regressoes "")
+foreach(metrica IN LISTS metricas)
+    string(JSON base ERROR_VARIABLE erro GET "${caso}" ${metrica})
+    if (erro)
+        message(WARNING "${NOME}: sem referência para ${metrica}")
+        continue()
+    endif()
+    set(atual ${valor_${metrica}})
+    set(tol ${tolerancia_${metrica}})
+    if (sentido_${metrica} STREQUAL "menor")
+        math(EXPR limite "${base} * (100 + ${tol}) / 100")
+        if (atual GREATER limite)
+            string(APPEND regressoes "\n  ${metrica}: ${atual} > ${limite} (referência ${base}, tolerância ${tol}%)")
+        endif()
+    else()
+        math(EXPR limite "${base} * 100 / (100 + ${tol})")
+        if (atual LESS limite)
+            string(APPEND regressoes "\n  ${metrica}: ${atual} < ${limite} (referência ${base}, tolerância ${tol}%)")
+        endif()
+    endif()
+    message(STATUS "${NOME}: ${metrica} = ${atual} (referência ${base})")
+endforeach()
+if (regressoes)
+    message(FATAL_ERROR "Regressão de desempenho em ${NOME}:${regressoes}")
+endif()
@@ -0,0 +1,128 @@
+# Teste do --trace: roda um cenário com --json-full --trace e confere o arquivo gravado.
+#
+# Uso (via CTest, ver tests/CMakeLists.txt):
+#   cmake -DSIMULADOR=<exe> -DCENARIO=<arquivo> -DTRACE=<json a gravar> -P trace.cmake
+#
+# - o arquivo é um JSON válido, com "displayTimeUnit": "ms" e o array traceEvents;
+# - cada fase do motor (carga, memoriaMinotauro, lacoEventos, relatorio) aparece uma vez
+#   como intervalo ("X") na trilha motor;
+# - os deslocamentos (categoria movimento) são, na ordem, os mesmos da linha do tempo
+#   `eventos` do --json-full: agente (a thread), origem, destino e início (1 unidade
+#   simulada = 1000 µs);
+# - os eventos instantâneos da simulação incluem os nomes passados em INSTANTES (separados
+#   por '|', opcional).
+cmake_minimum_required(VERSION 3.19) # string(JSON)
+
+# Converte um decimal sem expoente ("12.345678") em milésimos inteiros (12345)
+function(milesimos VALOR SAIDA)
+    if (NOT VALOR MATCHES "^([0-9]+)(\\.([0-9]*))?$")
+        message(FATAL_ERROR "Número inesperado: '${VALOR}'")
+    endif()
+    set(fracao "${CMAKE_MATCH_3}000")
+    string(SUBSTRING "${fracao}" 0 3 fracao)
+    math(EXPR numero "${CMAKE_MATCH_1} * 1000 + 1${fracao} - 1000")
+    set(${SAIDA} ${numero} PARENT_SCOPE)
+endfunction()
+
+# Parte inteira de um decimal sem expoente
+function(inteiro VALOR SAIDA)
+    if (NOT VALOR MATCHES "^([0-9]+)(\\.[0-9]*)?$")
+        message(FATAL_ERROR "Número inesperado: '${VALOR}'")
+    endif()
+    set(${SAIDA} ${CMAKE_MATCH_1} PARENT_SCOPE)
+endfunction()
+
+get_filename_component(diretorio "${TRACE}" DIRECTORY)
+file(MAKE_DIRECTORY "${diretorio}")
+file(REMOVE "${TRACE}")
+execute_process(COMMAND "${SIMULADOR}" "${CENARIO}" --json-full --trace "${TRACE}"
+                OUTPUT_VARIABLE resultado RESULT_VARIABLE rc)
+if (NOT rc EQUAL 0)
+    message(FATAL_ERROR "O simulador falhou (código ${rc}):\n${resultado}")
+endif()
+if (NOT EXISTS "${TRACE}")
+    message(FATAL_ERROR "O trace ${TRACE} não foi gravado")
+endif()
+file(READ "${TRACE}" trace)
+
+string(JSON unidade ERROR_VARIABLE erro GET "${trace}" displayTimeUnit)
+if (erro)
+    message(FATAL_ERROR "Trace inválido: ${erro}")
+endif()
+if (NOT unidade STREQUAL "ms")
+    message(FATAL_ERROR "displayTimeUnit '${unidade}', esperado 'ms'")
+endif()
+string(JSON numEventos LENGTH "${trace}" traceEvents)
+
+# Percorre o trace: fases do motor, deslocamentos (em ordem) e instantes
+set(fases)
+set(movimentos)
+set(instantes)
+math(EXPR ultimo "${numEventos} - 1")
+foreach(i RANGE ${ultimo})
+    string(JSON evento GET "${trace}" traceEvents ${i})
+    string(JSON fase GET "${evento}" ph)
+    string(JSON categoria ERROR_VARIABLE semCategoria GET "${evento}" cat)
+    if (semCategoria)
+        continue() # metadados (nomes de processos e threads)
+    endif()
+    string(JSON nome GET "${evento}" name)
+    if (categoria STREQUAL "motor")
+        if (NOT fase STREQUAL "X")
+            message(FATAL_ERROR "Fase do motor '${nome}' com ph '${fase}'")
+        endif()
+        list(APPEND fases "${nome}")
+    elseif (categoria STREQUAL "movimento")
+        string(JSON thread GET "${evento}" tid)
+        string(JSON origem GET "${evento}" args origem)
+        string(JSON destino GET "${evento}" args destino)
+        string(JSON ts GET "${evento}" ts)
+        inteiro("${ts}" ts)
+        list(APPEND movimentos "${thread}:${origem}:${destino}:${ts}")
+    elseif (categoria STREQUAL "simulacao")
+        list(APPEND instantes "${nome}")
+    endif()
+endforeach()
+
+list(LENGTH fases numFases)
+foreach(esperada carga memoriaMinotauro lacoEventos relatorio)
+    set(iguais ${fases})
+    list(FILTER iguais INCLUDE REGEX "^${esperada}$")
+    list(LENGTH iguais vezes)
+    if (NOT vezes EQUAL 1 OR NOT numFases EQUAL 4)
+        message(FATAL_ERROR "Fases do motor no trace: '${fases}' (esperada uma de cada: carga, memoriaMinotauro, lacoEventos, relatorio)")
+    endif()
+endforeach()
+
+# A mesma linha do tempo pelo --json-full
+set(esperados)
+string(JSON numMovimentos LENGTH "${resultado}" eventos)
+if (numMovimentos GREATER 0)
+    math(EXPR ultimo "${numMovimentos} - 1")
+    foreach(i RANGE ${ultimo})
+        string(JSON agente GET "${resultado}" eventos ${i} agente)
+        string(JSON origem GET "${resultado}" eventos ${i} origem)
+        string(JSON destino GET "${resultado}" eventos ${i} destino)
+        string(JSON inicio GET "${resultado}" eventos ${i} inicio)
+        milesimos("${inicio}" inicio)
+        if (agente STREQUAL "Prisioneiro")
+            set(thread 1)
+        else()
+            set(thread 2)
+        endif()
+        list(APPEND esperados "${thread}:${origem}:${destino}:${inicio}")
+    endforeach()
+endif()
+if (NOT movimentos STREQUAL esperados)
+    message(FATAL_ERROR "Deslocamentos do trace:\n  ${movimentos}\ndiferem da linha do tempo:\n  ${esperados}")
+endif()
+
+string(REPLACE "|" ";" INSTANTES "${INSTANTES}")
+foreach(instante IN LISTS INSTANTES)
+    if (NOT instante IN_LIST instantes)
+        message(FATAL_ERROR "Evento instantâneo '${instante}' ausente do trace (presentes: ${instantes})")
+    endif()
+endforeach()
+
+list(LENGTH movimentos numMovimentos)
+message(STATUS "Trace válido: ${numEventos} eventos, ${numMovimentos} deslocamentos iguais aos do --json-full")
@@ -0,0 +1,63 @@
+/**
+ * @file VerificaEscritorJson.cpp
+ * @brief Reais não finitos e estado do fluxo nas saídas JSON.
+ * @details NaN e infinitos não têm representação em JSON: `EscritorJson::valor(double)`
+ * os escreve como `null`, inclusive dentro de `imprimirJson`. As estatísticas e a
+ * contabilidade de memória são escritas pelo escritor, em notação fixa de 6 casas, sem
+ * mudar a formatação (flags e precisão) do fluxo de quem chama.
+ */
+
+#include "Verificacoes.h"
+#include "labirinto/SaidaJson.h"
+#include "utils/EscritorJson.h"
+#include "utils/Estatisticas.h"
+#include "utils/Memoria.h"
+#include <limits>
+#include <sstream>
+
+namespace {
+
+void verificarNaoFinitos() {
+    std::ostringstream saida;
+    {
+        EscritorJson json(saida);
+        json.abrirObjeto();
+        json.chave("nan").valor(std::numeric_limits<double>::quiet_NaN());
+        json.chave("inf").valor(std::numeric_limits<double>::infinity());
+        json.chave("menosInf").valor(-std::numeric_limits<double>::infinity());
+        json.chave("lista").abrirArray();
+        json.valor(std::numeric_limits<double>::infinity());
+        json.valor(0.25);
+        json.fecharArray();
+        json.fecharObjeto();
+    }
+    const std::string esperado = "{\"nan\": null, \"inf\": null, \"menosInf\": null, \"lista\": [null, 0.250000]}";
+    verificar(saida.str() == esperado, "reais não finitos: " + saida.str());
+}
+
+void verificarEstadoDoFluxo() {
+    Simulador::ResultadoSimulacao resultado{};
+    resultado.tempoReal = std::numeric_limits<double>::quiet_NaN();
+    Estatisticas estatisticas;
+    estatisticas.nsCarga = 1500000; // 1,5 ms
+    ContabilidadeMemoria memoria;
+    memoria.registrar(Subsistema::GRAFO, 1024);
+
+    std::ostringstream saida;
+    saida.precision(3);
+    imprimirJson(saida, resultado, nullptr, true, &estatisticas, &memoria);
+    const std::string texto = saida.str();
+    verificar(texto.find("\"tempoReal\": null") != std::string::npos, "tempoReal NaN no resultado: " + texto);
+    verificar(texto.find("\"estatisticas\": { \"tempoMs\": { \"carga\": 1.500000, ") != std::string::npos,
+              "tempos das estatísticas com 6 casas: " + texto);
+    verificar(texto.find("\"grafo\": { \"vivos\": 1024, \"pico\": 1024 }") != std::string::npos,
+              "bytes do grafo na memória: " + texto);
+    verificar(saida.precision() == 3 && !(saida.flags() & std::ios_base::fixed), "formatação do fluxo alterada");
+}
+
+} // namespace
+
+void verificarEscritorJson() {
+    verificarNaoFinitos();
+    verificarEstadoDoFluxo();
+}
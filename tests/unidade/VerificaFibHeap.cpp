@@ -0,0 +1,177 @@
+/**
+ * @file VerificaFibHeap.cpp
+ * @brief Heap de Fibonacci contra `std::priority_queue` em sequências aleatórias.
+ * @details As chaves são pares (prioridade, id), então o mínimo é único e cada extração
+ * tem que devolver exatamente o mesmo par da referência. Cada rodada:
+ * - cresce o heap por várias centenas de nós, além do primeiro bloco da arena (64);
+ * - une a ele um segundo heap e depois reaproveita o segundo, já vazio;
+ * - diminui muitas chaves depois de extrações (árvores consolidadas), provocando
+ *   cortes em cascata;
+ * - esvazia com `limpar` e repete sobre a mesma arena, que agora inclui blocos adotados;
+ * - por fim extrai tudo, conferindo a ordem.
+ */
+
+#include "Verificacoes.h"
+#include "estruturas/FibHeap.h"
+#include <functional>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr int RODADAS = 8;
+constexpr int REUSOS = 3; // ciclos de limpar e reaproveitar por rodada
+
+using Chave = std::pair<int, int>; // (prioridade, id): ids distintos desempatam
+using Heap = FibHeap<Chave>;
+
+/**
+ * @brief A referência: `std::priority_queue` com remoção preguiçosa. Diminuir uma chave
+ * empilha a nova; a antiga é descartada quando chega ao topo.
+ */
+struct Referencia {
+    std::priority_queue<Chave, std::vector<Chave>, std::greater<Chave>> fila;
+    std::vector<int> chaveAtual; // por id
+    std::vector<Heap::Handle> handles; // por id
+    std::vector<int> vivos; // ids no heap, para sortear um
+    std::vector<int> posicaoVivo; // por id: índice em `vivos`
+
+    void inserir(int id, int prioridade, Heap::Handle handle) {
+        if (static_cast<int>(chaveAtual.size()) <= id) {
+            chaveAtual.resize(id + 1);
+            handles.resize(id + 1);
+            posicaoVivo.resize(id + 1);
+        }
+        chaveAtual[id] = prioridade;
+        handles[id] = handle;
+        posicaoVivo[id] = static_cast<int>(vivos.size());
+        vivos.push_back(id);
+        fila.push({prioridade, id});
+    }
+
+    void diminuir(int id, int prioridade) {
+        chaveAtual[id] = prioridade;
+        fila.push({prioridade, id});
+    }
+
+    Chave minimo() {
+        while (fila.top().first != chaveAtual[fila.top().second]) fila.pop();
+        return fila.top();
+    }
+
+    Chave extrair() {
+        const Chave menor = minimo();
+        fila.pop();
+        const int ultimo = vivos.back();
+        vivos[posicaoVivo[menor.second]] = ultimo;
+        posicaoVivo[ultimo] = posicaoVivo[menor.second];
+        vivos.pop_back();
+        return menor;
+    }
+
+    void limpar() {
+        fila = {};
+        vivos.clear();
+    }
+
+    /// @brief Recebe os nós de `outra` (como `FibHeap::unir`), que fica vazia.
+    void absorver(Referencia& outra) {
+        for (int id : outra.vivos) inserir(id, outra.chaveAtual[id], outra.handles[id]);
+        outra.limpar();
+    }
+};
+
+/// @brief Confere tamanho e mínimo.
+bool comparar(const Heap& heap, Referencia& referencia, const std::string& caso) {
+    if (!verificar(heap.getTamanho() == static_cast<int>(referencia.vivos.size()),
+                   caso + ": tamanho " + std::to_string(heap.getTamanho()) + ", esperado "
+                   + std::to_string(referencia.vivos.size()))) return false;
+    if (!verificar(heap.ehVazio() == referencia.vivos.empty(), caso + ": ehVazio")) return false;
+    if (referencia.vivos.empty()) return true;
+    const Chave esperado = referencia.minimo();
+    return verificar(heap.getMin() == esperado, caso + ": mínimo (" + std::to_string(heap.getMin().first) + ", "
+                     + std::to_string(heap.getMin().second) + "), esperado (" + std::to_string(esperado.first)
+                     + ", " + std::to_string(esperado.second) + ")");
+}
+
+/**
+ * @brief `operacoes` passos sorteados entre inserir, extrair o mínimo e diminuir a chave
+ * de um nó vivo (para abaixo do mínimo atual em metade das vezes, o que corta o nó
+ * da sua árvore), nas proporções dadas.
+ * @return `false` na primeira divergência.
+ */
+bool executar(Heap& heap, Referencia& referencia, std::mt19937& gerador, int& proximoId, int operacoes,
+              double pInserir, double pExtrair, const std::string& caso) {
+    std::uniform_real_distribution<double> sorteio(0.0, 1.0);
+    std::uniform_int_distribution<int> prioridade(0, 100000);
+    for (int op = 0; op < operacoes; ++op) {
+        const std::string passo = caso + ", operação " + std::to_string(op);
+        const double s = sorteio(gerador);
+        if (s < pInserir || referencia.vivos.empty()) {
+            const int id = proximoId++;
+            const int p = prioridade(gerador);
+            referencia.inserir(id, p, heap.inserir({p, id}));
+        } else if (s < pInserir + pExtrair) {
+            const Chave esperado = referencia.extrair();
+            const Chave extraido = heap.extrairMin();
+            if (!verificar(extraido == esperado, passo + ": extraiu (" + std::to_string(extraido.first) + ", "
+                           + std::to_string(extraido.second) + "), esperado (" + std::to_string(esperado.first)
+                           + ", " + std::to_string(esperado.second) + ")")) return false;
+        } else {
+            const int id = referencia.vivos[std::uniform_int_distribution<int>(0, static_cast<int>(referencia.vivos.size()) - 1)(gerador)];
+            const int atual = referencia.chaveAtual[id];
+            const int nova = sorteio(gerador) < 0.5 ? referencia.minimo().first - 1 - prioridade(gerador) % 50
+                                                    : atual - std::uniform_int_distribution<int>(0, 1000)(gerador);
+            if (nova >= atual) continue;
+            heap.diminuirChave(referencia.handles[id], {nova, id});
+            referencia.diminuir(id, nova);
+            if (!verificar(referencia.handles[id]->getChave() == Chave(nova, id), passo + ": chave do handle")) return false;
+        }
+        if (!comparar(heap, referencia, passo)) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+void verificarFibHeap() {
+    std::mt19937 gerador(35);
+    int proximoId = 0;
+    for (int rodada = 0; rodada < RODADAS; ++rodada) {
+        Heap heap;
+        Referencia referencia;
+        for (int reuso = 0; reuso < REUSOS; ++reuso) {
+            const std::string caso = "rodada " + std::to_string(rodada) + ", reuso " + std::to_string(reuso);
+
+            // Crescimento além do primeiro bloco da arena
+            if (!executar(heap, referencia, gerador, proximoId, 600, 0.7, 0.1, caso + ", crescimento")) return;
+
+            // União: os nós (e os blocos) do outro heap passam para este
+            Heap outro;
+            Referencia referenciaOutro;
+            if (!executar(outro, referenciaOutro, gerador, proximoId, 300, 0.7, 0.1, caso + ", outro heap")) return;
+            heap.unir(outro);
+            referencia.absorver(referenciaOutro);
+            if (!comparar(heap, referencia, caso + ", após unir")) return;
+            if (!comparar(outro, referenciaOutro, caso + ", outro heap após unir")) return;
+            // O heap esvaziado por unir continua utilizável
+            if (!executar(outro, referenciaOutro, gerador, proximoId, 200, 0.6, 0.2, caso + ", outro heap reaproveitado")) return;
+
+            // Extrações consolidam as árvores; diminuições em nós profundos cortam em cascata
+            if (!executar(heap, referencia, gerador, proximoId, 1500, 0.15, 0.35, caso + ", cascatas")) return;
+
+            heap.limpar();
+            referencia.limpar();
+            if (!comparar(heap, referencia, caso + ", após limpar")) return;
+            if (!executar(heap, referencia, gerador, proximoId, 400, 0.8, 0.1, caso + ", após limpar")) return;
+        }
+        // Esvazia na ordem
+        while (!referencia.vivos.empty()) {
+            const Chave esperado = referencia.extrair();
+            if (!verificar(heap.extrairMin() == esperado, "rodada " + std::to_string(rodada) + ": ordem final")) return;
+        }
+        verificar(heap.ehVazio() && heap.getTamanho() == 0, "rodada " + std::to_string(rodada) + ": vazio no fim");
+    }
+}
@@ -0,0 +1,195 @@
+/**
+ * @file VerificaFilas.cpp
+ * @brief `Grafo::distanciasDe` com cada fila de prioridade contra a do heap de Fibonacci.
+ * @details Labirintos aleatórios de até algumas centenas de salas, com corredores
+ * paralelos, partes desconexas e pesos de faixas diferentes (até 10^6, para os baldes
+ * altos do heap radix). As distâncias de HeapQuaternario, HeapPareamento e HeapRadix
+ * têm que ser iguais às do FibHeap, com a forma compacta e pelas listas, e uma origem
+ * fora do labirinto dá INFINITO em todas as salas.
+ *
+ * O reparo da memória do Minotauro (`atualizarCorredor` com `setFilaReparo`) usa uma
+ * mesma fila para todas as linhas afetadas; com cada fila, depois de cada mudança de
+ * corredor, as distâncias têm que ser as do reparo com o FibHeap e cada próximo passo
+ * tem que estar num caminho mínimo. O heap radix, esvaziado, volta a aceitar chaves
+ * menores que a última extraída.
+ */
+
+#include "Verificacoes.h"
+#include "estruturas/FibHeap.h"
+#include "estruturas/HeapPareamento.h"
+#include "estruturas/HeapQuaternario.h"
+#include "estruturas/HeapRadix.h"
+#include "labirinto/Grafo.h"
+#include "labirinto/Minotauro.h"
+#include <stdexcept>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr int LABIRINTOS = 200;
+constexpr int ORIGENS_POR_LABIRINTO = 4;
+constexpr int LABIRINTOS_REPARO = 60;
+constexpr int MUDANCAS_POR_LABIRINTO = 20;
+
+using Item = std::pair<int, int>;
+
+template <typename Fila>
+bool compararFila(const Grafo& grafo, int origem, const std::vector<int>& esperado, const std::string& caso) {
+    const std::vector<int> dist = grafo.distanciasDe<Fila>(origem);
+    if (!verificar(dist.size() == esperado.size(), caso + ": tamanho do vetor de distâncias")) return false;
+    for (size_t sala = 0; sala < dist.size(); ++sala) {
+        if (!verificar(dist[sala] == esperado[sala], caso + ": sala " + std::to_string(sala) + " a "
+                       + std::to_string(dist[sala]) + ", esperado " + std::to_string(esperado[sala]))) return false;
+    }
+    return true;
+}
+
+bool compararFilas(const Grafo& grafo, int origem, const std::string& caso) {
+    const std::vector<int> esperado = grafo.distanciasDe<FibHeap<Item>>(origem);
+    return compararFila<HeapQuaternario<Item>>(grafo, origem, esperado, caso + ", quaternário")
+        && compararFila<HeapPareamento<Item>>(grafo, origem, esperado, caso + ", pareamento")
+        && compararFila<HeapRadix<Item>>(grafo, origem, esperado, caso + ", radix");
+}
+
+/// Uma fila esvaziada aceita qualquer chave, como no Dijkstra da próxima linha do reparo.
+void verificarRadixEsvaziado() {
+    HeapRadix<Item> fila;
+    try {
+        fila.inserir(Item{50, 0});
+        fila.extrairMin();
+        fila.inserir(Item{10, 1});
+        fila.inserir(Item{30, 2});
+        verificar(fila.extrairMin().first == 10 && fila.extrairMin().first == 30 && fila.ehVazio(),
+                  "radix esvaziado: ordem de extração");
+    } catch (const std::exception& e) {
+        verificar(false, std::string("radix esvaziado: ") + e.what());
+    }
+}
+
+bool compararReparo(const Grafo& grafo, const Minotauro& reparada, const Minotauro& referencia, const std::string& caso) {
+    const int n = grafo.getNumVertices();
+    for (int i = 0; i < n; ++i) {
+        const std::vector<int>& dist = reparada.lembrarDistancias(i);
+        const std::vector<int>& distRef = referencia.lembrarDistancias(i);
+        for (int j = 0; j < n; ++j) {
+            const std::string par = caso + ": " + std::to_string(i) + " -> " + std::to_string(j);
+            if (!verificar(dist[j] == distRef[j], par + " distância " + std::to_string(dist[j]) + ", esperada "
+                           + std::to_string(distRef[j]))) return false;
+            if (i == j || distRef[j] == Grafo::INFINITO) continue;
+            const int passo = reparada.lembrarProxPassos(i)[j];
+            const int peso = passo < 0 ? -1 : grafo.getPesoAresta(i, passo);
+            if (!verificar(peso > 0 && peso + referencia.lembrarDistancias(passo)[j] == distRef[j],
+                           par + " passo " + std::to_string(passo) + " fora de um caminho mínimo")) return false;
+        }
+    }
+    return true;
+}
+
+/// Reparo do Minotauro com cada fila contra o reparo com o FibHeap, nas mesmas mudanças.
+void verificarReparoComFilas() {
+    const std::pair<Minotauro::FilaReparo, const char*> filas[] = {
+        {Minotauro::FilaReparo::QUATERNARIO, "quaternário"},
+        {Minotauro::FilaReparo::PAREAMENTO, "pareamento"},
+        {Minotauro::FilaReparo::RADIX, "radix"},
+    };
+    std::mt19937 gerador(41);
+    for (int labirinto = 0; labirinto < LABIRINTOS_REPARO; ++labirinto) {
+        const int n = std::uniform_int_distribution<int>(4, 40)(gerador);
+        std::uniform_int_distribution<int> sala(0, n - 1);
+        std::uniform_int_distribution<int> peso(1, 9);
+        std::bernoulli_distribution temCorredor(3.0 / n);
+
+        // Sem corredores paralelos, como em `definirPeso`
+        Grafo grafo;
+        grafo.setNumVertices(n);
+        int numArestas = 0;
+        for (int u = 0; u < n; ++u) {
+            for (int v = u + 1; v < n; ++v) {
+                if (temCorredor(gerador)) {
+                    grafo.adicionar_aresta(u, v, peso(gerador));
+                    numArestas++;
+                }
+            }
+        }
+        grafo.setNumArestas(numArestas);
+        grafo.set_saida(n - 1);
+        grafo.compactar();
+
+        Minotauro referencia(0, 0, grafo, n);
+        referencia.lembrarCaminhos();
+        std::vector<Minotauro> reparadas;
+        for (const auto& fila : filas) {
+            reparadas.push_back(referencia);
+            reparadas.back().setFilaReparo(fila.first);
+        }
+        for (int mudanca = 0; mudanca < MUDANCAS_POR_LABIRINTO; ++mudanca) {
+            const int u = sala(gerador);
+            int v = sala(gerador);
+            if (u == v) v = (v + 1) % n;
+            // Metade das mudanças derruba o corredor, a outra sorteia um peso (alonga, se existia)
+            const int pesoNovo = std::uniform_int_distribution<int>(0, 1)(gerador) == 0 ? 0 : peso(gerador);
+            const int pesoAntigo = grafo.definirPeso(u, v, pesoNovo);
+            const std::string caso = "reparo, labirinto " + std::to_string(labirinto) + ", mudança " + std::to_string(mudanca)
+                                   + " (" + std::to_string(u) + "-" + std::to_string(v) + ": " + std::to_string(pesoAntigo)
+                                   + " -> " + std::to_string(pesoNovo) + ")";
+            try {
+                const int linhas = referencia.atualizarCorredor(u, v, pesoAntigo, pesoNovo);
+                for (size_t f = 0; f < reparadas.size(); ++f) {
+                    const int linhasFila = reparadas[f].atualizarCorredor(u, v, pesoAntigo, pesoNovo);
+                    if (!verificar(linhasFila == linhas, caso + ", " + filas[f].second + ": linhas reparadas")) return;
+                    if (!compararReparo(grafo, reparadas[f], referencia, caso + ", " + filas[f].second)) return;
+                }
+            } catch (const std::exception& e) {
+                verificar(false, caso + ": " + e.what());
+                return;
+            }
+        }
+    }
+}
+
+} // namespace
+
+void verificarFilasPrioridade() {
+    std::mt19937 gerador(37);
+    const int pesosMaximos[] = {1, 9, 1000, 1000000};
+    for (int labirinto = 0; labirinto < LABIRINTOS; ++labirinto) {
+        const int n = std::uniform_int_distribution<int>(1, 300)(gerador);
+        const int pesoMaximo = pesosMaximos[labirinto % 4];
+        // Entre ~0,5 e ~3 corredores por sala: os mais esparsos ficam desconexos
+        const int numArestas = std::uniform_int_distribution<int>(n / 2, 3 * n)(gerador);
+        std::uniform_int_distribution<int> sala(0, n - 1);
+        std::uniform_int_distribution<int> peso(1, pesoMaximo);
+
+        Grafo grafo;
+        grafo.setNumVertices(n);
+        for (int a = 0; a < numArestas && n > 1; ++a) {
+            const int u = sala(gerador);
+            int v = sala(gerador);
+            if (u == v) v = (v + 1) % n;
+            grafo.adicionar_aresta(u, v, peso(gerador)); // pode repetir um par: corredores paralelos
+        }
+        grafo.setNumArestas(numArestas);
+        grafo.set_saida(n - 1);
+
+        const std::string caso = "labirinto " + std::to_string(labirinto) + " (" + std::to_string(n)
+                               + " salas, pesos até " + std::to_string(pesoMaximo) + ")";
+        for (int o = 0; o < ORIGENS_POR_LABIRINTO; ++o) {
+            if (!compararFilas(grafo, sala(gerador), caso + ", pelas listas")) return;
+        }
+        grafo.compactar();
+        for (int o = 0; o < ORIGENS_POR_LABIRINTO; ++o) {
+            if (!compararFilas(grafo, sala(gerador), caso + ", compacto")) return;
+        }
+        for (int origem : {-1, n}) {
+            const std::vector<int> dist = grafo.distanciasDe<HeapRadix<Item>>(origem);
+            bool todasInfinitas = true;
+            for (int d : dist) todasInfinitas = todasInfinitas && d == Grafo::INFINITO;
+            if (!verificar(todasInfinitas, caso + ": origem " + std::to_string(origem) + " fora do labirinto")) return;
+            if (!compararFilas(grafo, origem, caso + ", origem fora do labirinto")) return;
+        }
+    }
+    verificarRadixEsvaziado();
+    verificarReparoComFilas();
+}
@@ -0,0 +1,110 @@
+/**
+ * @file VerificaListaAdj.cpp
+ * @brief O vetor pequeno `listaAdj` contra `std::vector` em sequências aleatórias.
+ * @details Algumas listas sofrem inserções no fim e remoções no meio, passando da
+ * capacidade interna (4) para o heap e voltando a encolher; outras são movidas
+ * (construção e atribuição, a partir de listas internas e no heap, e sobre si
+ * mesmas). Depois de cada passo o conteúdo e a ordem têm que ser os do modelo. Os
+ * elementos contam as próprias instâncias: no fim não pode sobrar nenhuma viva
+ * (um elemento destruído duas vezes ou esquecido altera a conta).
+ */
+
+#include "Verificacoes.h"
+#include "estruturas/MinhaListaAdj.h"
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr int RODADAS = 200;
+constexpr int LISTAS = 6;
+constexpr int PASSOS = 400;
+
+/// @brief Inteiro que conta as instâncias vivas; um movido fica com -1.
+struct Contado {
+    static int vivos;
+    int valor;
+
+    explicit Contado(int valor) : valor(valor) { vivos++; }
+    Contado(const Contado& outro) : valor(outro.valor) { vivos++; }
+    Contado(Contado&& outro) noexcept : valor(outro.valor) { outro.valor = -1; vivos++; }
+    Contado& operator=(const Contado&) = default;
+    Contado& operator=(Contado&& outro) noexcept {
+        valor = outro.valor;
+        outro.valor = -1;
+        return *this;
+    }
+    ~Contado() { vivos--; }
+};
+int Contado::vivos = 0;
+
+using Lista = listaAdj<Contado>;
+
+bool comparar(const Lista& lista, const std::vector<int>& modelo, const std::string& caso) {
+    if (!verificar(lista.size() == static_cast<int>(modelo.size()), caso + ": tamanho " + std::to_string(lista.size())
+                   + ", esperado " + std::to_string(modelo.size()))) return false;
+    if (!verificar(lista.vazia() == modelo.empty(), caso + ": vazia")) return false;
+    // Acima da capacidade interna os elementos só podem estar no heap
+    if (!verificar(lista.size() <= 4 || lista.bytesNoHeap() >= sizeof(Contado) * static_cast<size_t>(lista.size()), caso + ": bytes no heap")) return false;
+    int i = 0;
+    for (const Contado& elemento : lista) {
+        if (!verificar(elemento.valor == modelo[i] && lista[i].valor == modelo[i],
+                       caso + ": posição " + std::to_string(i) + " com " + std::to_string(elemento.valor)
+                       + ", esperado " + std::to_string(modelo[i]))) return false;
+        i++;
+    }
+    return true;
+}
+
+} // namespace
+
+void verificarListaAdj() {
+    std::mt19937 gerador(38);
+    std::uniform_int_distribution<int> qualLista(0, LISTAS - 1);
+    std::uniform_int_distribution<int> operacao(0, 99);
+    int proximoValor = 0;
+    for (int rodada = 0; rodada < RODADAS; ++rodada) {
+        {
+            std::vector<Lista> listas(LISTAS);
+            std::vector<std::vector<int>> modelos(LISTAS);
+            for (int passo = 0; passo < PASSOS; ++passo) {
+                const int a = qualLista(gerador);
+                const int b = qualLista(gerador);
+                const int op = operacao(gerador);
+                const std::string caso = "rodada " + std::to_string(rodada) + ", passo " + std::to_string(passo);
+                if (op < 55) {
+                    listas[a].inserir_no_fim(Contado(proximoValor));
+                    modelos[a].push_back(proximoValor++);
+                } else if (op < 80) {
+                    if (modelos[a].empty()) continue;
+                    const int indice = std::uniform_int_distribution<int>(0, static_cast<int>(modelos[a].size()) - 1)(gerador);
+                    listas[a].remover(indice);
+                    modelos[a].erase(modelos[a].begin() + indice);
+                } else if (op < 88) {
+                    // Construção por movimento; a origem fica vazia e continua utilizável
+                    Lista movida(std::move(listas[a]));
+                    if (!verificar(listas[a].vazia() && listas[a].bytesNoHeap() == 0, caso + ": origem do movimento")) return;
+                    if (!comparar(movida, modelos[a], caso + ", construída por movimento")) return;
+                    listas[a] = std::move(movida);
+                } else if (op < 97) {
+                    // Atribuição por movimento sobre uma lista com elementos (ou sobre si mesma)
+                    Lista& destino = listas[b];
+                    destino = std::move(listas[a]);
+                    if (a != b) {
+                        modelos[b] = std::move(modelos[a]);
+                        modelos[a].clear();
+                    }
+                    if (!comparar(listas[a], modelos[a], caso + ", origem da atribuição")) return;
+                } else {
+                    const int capacidade = std::uniform_int_distribution<int>(0, 32)(gerador);
+                    listas[a].reserve(capacidade);
+                }
+                if (!comparar(listas[a], modelos[a], caso + ", lista " + std::to_string(a))) return;
+                if (!comparar(listas[b], modelos[b], caso + ", lista " + std::to_string(b))) return;
+            }
+        }
+        if (!verificar(Contado::vivos == 0, "rodada " + std::to_string(rodada) + ": " + std::to_string(Contado::vivos)
+                       + " elementos vivos após destruir as listas")) return;
+    }
+}
@@ -0,0 +1,130 @@
+/**
+ * @file VerificaMinotauro.cpp
+ * @brief Reparo incremental da memória do Minotauro contra o Floyd-Warshall completo.
+ * @details Em labirintos aleatórios (sem corredores paralelos), cada mudança de
+ * corredor — abrir, encurtar, alongar ou desabar — é aplicada como na simulação:
+ * `Grafo::definirPeso` seguido de `Minotauro::atualizarCorredor`. Depois de cada uma:
+ * - as distâncias reparadas são iguais às de um `lembrarCaminhos` novo;
+ * - cada próximo passo é um vizinho pelo qual passa um caminho mínimo (com empates,
+ *   o passo pode diferir do escolhido pelo Floyd-Warshall);
+ * - a forma compacta, atualizada só nos trechos das duas salas, coincide com as
+ *   listas, o preenchimento do fim continua intacto e o alias de cada sala dá a cada vizinho
+ *   a probabilidade 1/peso normalizada.
+ */
+
+#include "Verificacoes.h"
+#include "labirinto/Grafo.h"
+#include "labirinto/Minotauro.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr int LABIRINTOS = 100;
+constexpr int MUDANCAS_POR_LABIRINTO = 20;
+
+void verificarCompacto(const Grafo& grafo, const std::string& caso) {
+    const int n = grafo.getNumVertices();
+    for (int sala = 0; sala < n; ++sala) {
+        const Grafo::Vizinhanca vizinhos = grafo.vizinhanca(sala);
+        const auto& lista = grafo.get_vizinhos(sala);
+        if (!verificar(vizinhos.grau == lista.size(), caso + ": grau da sala " + std::to_string(sala))) return;
+        double soma = 0.0;
+        for (int k = 0; k < vizinhos.grau; ++k) {
+            if (!verificar(vizinhos.ids[k] == lista[k].primeiro && vizinhos.pesos[k] == lista[k].segundo,
+                           caso + ": vizinho " + std::to_string(k) + " da sala " + std::to_string(sala))) return;
+            soma += 1.0 / vizinhos.pesos[k];
+        }
+        // Probabilidade de cada coluna: a própria parte mais o que sobra das colunas que a apontam
+        std::vector<double> probabilidade(vizinhos.grau, 0.0);
+        for (int k = 0; k < vizinhos.grau; ++k) {
+            probabilidade[k] += grafo.probAlias(sala)[k] / vizinhos.grau;
+            probabilidade[grafo.indiceAlias(sala)[k]] += (1.0 - grafo.probAlias(sala)[k]) / vizinhos.grau;
+        }
+        for (int k = 0; k < vizinhos.grau; ++k) {
+            const double esperada = (1.0 / vizinhos.pesos[k]) / soma;
+            if (!verificar(std::abs(probabilidade[k] - esperada) < 1e-9,
+                           caso + ": alias do vizinho " + std::to_string(k) + " da sala " + std::to_string(sala))) return;
+        }
+    }
+    // A sala de trecho mais ao fim (salas que cresceram mudam para lá) termina no preenchimento
+    Grafo::Vizinhanca ultima = grafo.vizinhanca(0);
+    for (int sala = 1; sala < n; ++sala) {
+        if (grafo.vizinhanca(sala).ids > ultima.ids) ultima = grafo.vizinhanca(sala);
+    }
+    for (int k = 0; k < Grafo::PREENCHIMENTO_SIMD; ++k) {
+        verificar(ultima.ids[ultima.grau + k] == -1 && ultima.pesos[ultima.grau + k] == Grafo::INFINITO,
+                  caso + ": preenchimento do CSR");
+    }
+}
+
+void verificarMemoria(const Grafo& grafo, const Minotauro& reparada, const std::string& caso) {
+    const int n = grafo.getNumVertices();
+    Minotauro referencia(0, 0, grafo, n);
+    referencia.lembrarCaminhos();
+    for (int i = 0; i < n; ++i) {
+        const std::vector<int>& dist = reparada.lembrarDistancias(i);
+        const std::vector<int>& distRef = referencia.lembrarDistancias(i);
+        for (int j = 0; j < n; ++j) {
+            const std::string par = caso + ": " + std::to_string(i) + " -> " + std::to_string(j);
+            if (!verificar(dist[j] == distRef[j], par + " distância " + std::to_string(dist[j]) + ", esperada " + std::to_string(distRef[j]))) return;
+            if (i == j) continue;
+            const int passo = reparada.lembrarProxPassos(i)[j];
+            if (distRef[j] == Grafo::INFINITO) {
+                if (!verificar(passo == -1, par + " sem caminho, mas com passo")) return;
+                continue;
+            }
+            const int peso = passo < 0 ? -1 : grafo.getPesoAresta(i, passo);
+            if (!verificar(peso > 0 && referencia.lembrarDistancias(passo)[j] != Grafo::INFINITO
+                               && peso + referencia.lembrarDistancias(passo)[j] == distRef[j],
+                           par + " passo " + std::to_string(passo) + " fora de um caminho mínimo")) return;
+        }
+    }
+}
+
+} // namespace
+
+void verificarReparoMinotauro() {
+    std::mt19937 gerador(29);
+    for (int labirinto = 0; labirinto < LABIRINTOS; ++labirinto) {
+        const int n = std::uniform_int_distribution<int>(4, 24)(gerador);
+        std::uniform_int_distribution<int> sala(0, n - 1);
+        std::uniform_int_distribution<int> peso(1, 9);
+        std::bernoulli_distribution temCorredor(3.0 / n);
+
+        Grafo grafo;
+        grafo.setNumVertices(n);
+        int numArestas = 0;
+        for (int u = 0; u < n; ++u) {
+            for (int v = u + 1; v < n; ++v) {
+                if (temCorredor(gerador)) {
+                    grafo.adicionar_aresta(u, v, peso(gerador));
+                    numArestas++;
+                }
+            }
+        }
+        grafo.setNumArestas(numArestas);
+        grafo.set_saida(n - 1);
+        grafo.compactar();
+
+        Minotauro minotauro(0, 0, grafo, n);
+        minotauro.lembrarCaminhos();
+        for (int mudanca = 0; mudanca < MUDANCAS_POR_LABIRINTO; ++mudanca) {
+            const int u = sala(gerador);
+            int v = sala(gerador);
+            if (u == v) v = (v + 1) % n;
+            // Um terço das mudanças derruba o corredor (se existir)
+            const int pesoNovo = std::uniform_int_distribution<int>(0, 2)(gerador) == 0 ? 0 : peso(gerador);
+            const int pesoAntigo = grafo.definirPeso(u, v, pesoNovo);
+            minotauro.atualizarCorredor(u, v, pesoAntigo, pesoNovo);
+
+            const std::string caso = "labirinto " + std::to_string(labirinto) + ", mudança " + std::to_string(mudanca)
+                                   + " (" + std::to_string(u) + "-" + std::to_string(v) + ": " + std::to_string(pesoAntigo)
+                                   + " -> " + std::to_string(pesoNovo) + ")";
+            verificar(grafo.estaCompacto(), caso + ": forma compacta descartada");
+            verificarCompacto(grafo, caso);
+            verificarMemoria(grafo, minotauro, caso);
+        }
+    }
+}
@@ -0,0 +1,48 @@
+/**
+ * @file Verificacoes.h
+ * @brief Grupos de verificações executados por `labirinto_testes` e o registro de falhas.
+ * @details Cada grupo compara uma estrutura ou algoritmo com uma referência simples
+ * (Floyd-Warshall completo, `std::priority_queue`, o heap de Fibonacci) sobre
+ * entradas pseudoaleatórias de semente fixa. Uma falha é impressa em `std::cerr` e
+ * o grupo continua; `labirinto_testes` sai com código 1 se houver alguma.
+ */
+
+#pragma once
+
+#include <iostream>
+#include <string>
+
+/// @brief Número de falhas registradas até agora.
+inline int& falhasVerificacao() {
+    static int falhas = 0;
+    return falhas;
+}
+
+/**
+ * @brief Registra uma falha se `condicao` for falsa.
+ * @param condicao O que deveria valer.
+ * @param descricao O caso, impresso na falha.
+ * @return `condicao`, para interromper um laço após a primeira falha.
+ */
+inline bool verificar(bool condicao, const std::string& descricao) {
+    if (!condicao) {
+        std::cerr << "FALHA: " << descricao << '\n';
+        ++falhasVerificacao();
+    }
+    return condicao;
+}
+
+/// @brief Heap de Fibonacci (inserir, extrair, diminuir chave, unir, limpar) contra `std::priority_queue`.
+void verificarFibHeap();
+
+/// @brief `Grafo::distanciasDe` e o reparo do Minotauro com HeapQuaternario, HeapPareamento e HeapRadix contra o FibHeap.
+void verificarFilasPrioridade();
+
+/// @brief Vetor pequeno das listas de adjacência (capacidade interna, heap, movimento, remoção) contra `std::vector`.
+void verificarListaAdj();
+
+/// @brief Reparo incremental da memória do Minotauro e forma compacta após mudanças de corredor.
+void verificarReparoMinotauro();
+
+/// @brief Reais não finitos como `null` e saídas JSON sem mudar a formatação do fluxo.
+void verificarEscritorJson();
@@ -0,0 +1,37 @@
+/**
+ * @file main.cpp
+ * @brief Ponto de entrada de `labirinto_testes`.
+ * @details Uso: `labirinto_testes [grupo]`. Sem grupo, executa todos. Sai com
+ * código 1 se alguma verificação falhar e 2 se o grupo não existir.
+ */
+
+#include "Verificacoes.h"
+#include "utils/Logger.h"
+#include <utility>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    const std::vector<std::pair<std::string, void (*)()>> grupos = {
+        {"fib_heap", verificarFibHeap},
+        {"filas_prioridade", verificarFilasPrioridade},
+        {"lista_adj", verificarListaAdj},
+        {"reparo_minotauro", verificarReparoMinotauro},
+        {"escritor_json", verificarEscritorJson},
+    };
+    const std::string pedido = argc > 1 ? argv[1] : "";
+
+    Logger::setLevel(LogLevel::ERROR); // as estruturas verificadas registram logs informativos
+    bool executou = false;
+    for (const auto& [nome, grupo] : grupos) {
+        if (!pedido.empty() && pedido != nome) continue;
+        const int antes = falhasVerificacao();
+        grupo();
+        executou = true;
+        std::cout << nome << ": " << (falhasVerificacao() > antes ? "falhou" : "ok") << '\n';
+    }
+    if (!executou) {
+        std::cerr << "Grupo desconhecido: " << pedido << '\n';
+        return 2;
+    }
+    return falhasVerificacao() ? 1 : 0;
+}